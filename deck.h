@@ -0,0 +1,235 @@
+/* deck.h from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
+
+#ifndef DECK_H
+#define DECK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duplex.h"
+#include "lanes.h"
+
+#ifndef duplex_deck_permute
+#define duplex_deck_permute duplex_xoodoo6
+#endif
+
+#ifndef duplex_deck_permute_lanes
+#define duplex_deck_permute_lanes duplex_lanes_expand(duplex_deck_permute)
+#endif
+
+typedef uint32x4_t duplex_deck_t[6];
+
+enum {
+  duplex_deck_block = 3 * sizeof(uint32x4_t),
+  duplex_deck_size = sizeof(duplex_deck_t)
+};
+
+static inline void duplex_deck_rollc(uint32x4_t state[3]) {
+  uint32_t x = state[0][0], y = state[1][0];
+  x ^= x << 13 ^ (y << 3 | y >> 29);
+  state[0] = (uint32x4_t) { state[0][1], state[0][2], state[0][3], y };
+  state[1] = (uint32x4_t) { state[1][1], state[1][2], state[1][3],
+    state[2][0] };
+  state[2] = (uint32x4_t) { state[2][1], state[2][2], state[2][3], x };
+}
+
+static inline void duplex_deck_rolle(uint32x4_t state[3]) {
+  uint32_t x = state[0][0], y = state[1][0], z = state[2][0];
+  x = (x << 5 | x >> 27) ^ (y << 13 | y >> 19) ^ (y & z) ^ 7;
+  state[0] = (uint32x4_t) { state[0][1], state[0][2], state[0][3], y };
+  state[1] = (uint32x4_t) { state[1][1], state[1][2], state[1][3], z };
+  state[2] = (uint32x4_t) { state[2][1], state[2][2], state[2][3], x };
+}
+
+static inline void duplex_deck_batch(duplex_lane_t lanes[12], size_t count) {
+  if (count < 3) {
+    for (size_t j = 0; j < count; j++) {
+      uint32x4_t state[3];
+      for (int i = 0; i < 3; i++)
+        state[i] = (uint32x4_t) { lanes[4 * i][j], lanes[4 * i + 1][j],
+          lanes[4 * i + 2][j], lanes[4 * i + 3][j] };
+      duplex_deck_permute(state);
+      for (int i = 0; i < 12; i++)
+        lanes[i][j] = state[i >> 2][i & 3];
+    }
+  } else {
+    duplex_deck_permute_lanes(lanes);
+  }
+}
+
+static inline void duplex_deck_key(duplex_deck_t deck, const void *key,
+    size_t length) {
+  uint8_t block[duplex_deck_block] = { 0 };
+
+  if (length < duplex_deck_block) {
+    __builtin_memcpy(block, key, length);
+    block[length] = 1;
+  } else {
+    /* Long keys are hashed, with a distinct final byte to separate them */
+    duplex_t state = { 0 };
+    duplex_absorb(state, key, length);
+    duplex_pad(state);
+    duplex_squeeze(state, block, 32);
+    duplex_zero(state, duplex_size);
+    block[32] = 2;
+  }
+
+  for (int i = 0; i < 3; i++) {
+    deck[i] = duplex_get(block + 16 * i);
+    deck[i + 3] = (uint32x4_t) { 0 };
+  }
+  duplex_permute(deck);
+  duplex_zero(block, sizeof(block));
+}
+
+static inline void duplex_deck_string(duplex_deck_t deck, const void *data,
+    size_t length, uint8_t frame) {
+  const uint8_t *bytes = data;
+  duplex_lane_t lanes[12] = { 0 }, masks[12];
+  uint32_t mask[12 + duplex_lanes] = { 0 };
+  size_t blocks = length / duplex_deck_block + 1;
+
+  for (size_t i = 0; i < blocks; i += duplex_lanes) {
+    size_t count = blocks - i < duplex_lanes ? blocks - i : duplex_lanes;
+
+    /* Each rollc shifts the mask along one word and appends a new one */
+    for (int k = 0; k < 12; k++)
+      mask[k] = deck[k >> 2][k & 3];
+    for (size_t j = 0; j < count; j++) {
+      uint32_t x = mask[j], y = mask[j + 4];
+      mask[j + 12] = x ^ x << 13 ^ (y << 3 | y >> 29);
+    }
+    for (int k = 0; k < 12; k++)
+      __builtin_memcpy(&masks[k], mask + k, sizeof(duplex_lane_t));
+
+    for (size_t j = 0; j < count; j++) {
+      const uint8_t *block = bytes + (i + j) * duplex_deck_block;
+      uint8_t last[duplex_deck_block] = { 0 };
+
+      if (i + j + 1 == blocks) {
+        __builtin_memcpy(last, block, length % duplex_deck_block);
+        last[length % duplex_deck_block] = frame;
+        block = last;
+      }
+
+      for (int k = 0; k < 12; k += 4) {
+        uint32x4_t words = duplex_get(block + 4 * k);
+        for (int l = 0; l < 4; l++)
+          lanes[k + l][j] = words[l];
+      }
+    }
+
+    for (int k = 0; k < 12; k++)
+      lanes[k] ^= masks[k];
+    duplex_deck_batch(lanes, count);
+    for (int k = 0; k < 12; k++) {
+      uint32_t sum = 0;
+      for (size_t j = 0; j < count; j++)
+        sum ^= lanes[k][j];
+      deck[3 + (k >> 2)][k & 3] ^= sum;
+      deck[k >> 2][k & 3] = mask[count + k];
+    }
+  }
+  duplex_deck_rollc(deck);
+}
+
+static inline void duplex_deck_stream(const duplex_deck_t deck, void *data,
+    size_t length, size_t offset, int mix) {
+  uint8_t *bytes = data;
+  duplex_lane_t lanes[12];
+  uint32_t roll[12 + duplex_lanes] = { 0 };
+  uint32x4_t state[3];
+  size_t blocks;
+
+  for (int k = 0; k < 3; k++)
+    state[k] = deck[k + 3];
+  duplex_deck_permute(state);
+  for (size_t i = offset / duplex_deck_block; i > 0; i--)
+    duplex_deck_rolle(state);
+  for (int k = 0; k < 12; k++)
+    roll[k] = state[k >> 2][k & 3];
+
+  offset %= duplex_deck_block;
+  blocks = (offset + length + duplex_deck_block - 1) / duplex_deck_block;
+
+  for (size_t i = 0; i < blocks; i += duplex_lanes) {
+    size_t count = blocks - i < duplex_lanes ? blocks - i : duplex_lanes;
+
+    /* Each rolle shifts the state along one word and appends a new one */
+    for (size_t j = 0; j < count; j++) {
+      uint32_t x = roll[j], y = roll[j + 4], z = roll[j + 8];
+      roll[j + 12] = (x << 5 | x >> 27) ^ (y << 13 | y >> 19) ^ (y & z) ^ 7;
+    }
+    for (int k = 0; k < 12; k++)
+      __builtin_memcpy(&lanes[k], roll + k, sizeof(duplex_lane_t));
+    for (int k = 0; k < 12; k++)
+      roll[k] = roll[count + k];
+
+    duplex_deck_batch(lanes, count);
+    for (size_t j = 0; j < count; j++) {
+      uint8_t block[duplex_deck_block];
+      uint8_t *out = offset == 0 && length >= duplex_deck_block
+        ? bytes : block;
+
+      for (int k = 0; k < 12; k += 4) {
+        uint32x4_t words = deck[k >> 2];
+        for (int l = 0; l < 4; l++)
+          words[l] ^= lanes[k + l][j];
+        if (mix && out == bytes)
+          words ^= duplex_get(bytes + 4 * k);
+        duplex_put(out + 4 * k, words);
+      }
+
+      if (out == bytes) {
+        bytes += duplex_deck_block, length -= duplex_deck_block;
+        continue;
+      }
+
+      for (size_t k = offset; k < duplex_deck_block && length; k++) {
+        *bytes = mix ? *bytes ^ block[k] : block[k];
+        bytes++, length--;
+      }
+      offset = 0;
+    }
+  }
+}
+
+static inline void duplex_deck_absorb(duplex_deck_t deck, const void *data,
+    size_t length) {
+  duplex_deck_string(deck, data, length, 1);
+}
+
+static inline void duplex_deck_squeeze(const duplex_deck_t deck, void *data,
+    size_t length) {
+  duplex_deck_stream(deck, data, length, 0, 0);
+}
+
+static inline void duplex_deck_encrypt(duplex_deck_t deck, void *data,
+    size_t length) {
+  duplex_deck_stream(deck, data, length, duplex_rate, 1);
+  duplex_deck_string(deck, data, length, 3);
+}
+
+static inline void duplex_deck_decrypt(duplex_deck_t deck, void *data,
+    size_t length) {
+  duplex_deck_t copy;
+  __builtin_memcpy(copy, deck, duplex_deck_size);
+  duplex_deck_string(deck, data, length, 3);
+  duplex_deck_stream(copy, data, length, duplex_rate, 1);
+  duplex_zero(copy, duplex_deck_size);
+}
+
+static inline void duplex_deck_seal(duplex_deck_t deck, void *data,
+    size_t length) {
+  duplex_deck_encrypt(deck, data, length);
+  duplex_deck_squeeze(deck, (uint8_t *) data + length, duplex_rate);
+}
+
+static inline int duplex_deck_open(duplex_deck_t deck, void *data,
+    size_t length) {
+  uint8_t tag[duplex_rate];
+  duplex_deck_decrypt(deck, data, length);
+  duplex_deck_squeeze(deck, tag, duplex_rate);
+  return duplex_compare(tag, (uint8_t *) data + length, duplex_rate);
+}
+
+#endif
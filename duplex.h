@@ -6,6 +6,23 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#if defined __AVX512BW__ && defined __AVX512VL__
+#include <immintrin.h>
+#define duplex_masked 1
+#elif defined duplex_dispatch && defined __x86_64__
+#include <immintrin.h>
+#define duplex_masked (duplex_masked_cpu)
+
+/* Test the CPU once at startup rather than on every partial block */
+static int duplex_masked_cpu;
+
+__attribute__((constructor)) static void duplex_masked_detect(void) {
+  __builtin_cpu_init();
+  duplex_masked_cpu = __builtin_cpu_supports("avx512bw")
+    && __builtin_cpu_supports("avx512vl");
+}
+#endif
+
 #if defined __clang_major__ && __clang_major__ >= 4
 #define duplex_swap(x, ...) __builtin_shufflevector(x, x, __VA_ARGS__)
 #elif defined __GNUC__ && __GNUC__ >= 5
@@ -64,13 +81,13 @@ static inline void duplex_gimli(uint32x4_t state[3]) {
   }
 }
 
-static inline void duplex_xoodoo(uint32x4_t state[3]) {
+static inline void duplex_xoodoo_rounds(uint32x4_t state[3], int rounds) {
   const uint32_t rk[12] = {
     0x058, 0x038, 0x3c0, 0x0d0, 0x120, 0x014,
     0x060, 0x02c, 0x380, 0x0f0, 0x1a0, 0x012
   };
 
-  for (int round = 0; round < 12; round++) {
+  for (int round = 12 - rounds; round < 12; round++) {
     uint32x4_t p = duplex_swap(state[0] ^ state[1] ^ state[2], 3, 0, 1, 2);
     uint32x4_t e = (p << 5 | p >> 27) ^ (p << 14 | p >> 18);
     state[0] ^= e, state[1] ^= e, state[2] ^= e;
@@ -88,6 +105,14 @@ static inline void duplex_xoodoo(uint32x4_t state[3]) {
   }
 }
 
+static inline void duplex_xoodoo(uint32x4_t state[3]) {
+  duplex_xoodoo_rounds(state, 12);
+}
+
+static inline void duplex_xoodoo6(uint32x4_t state[3]) {
+  duplex_xoodoo_rounds(state, 6);
+}
+
 static inline uint32x4_t duplex_get(const uint8_t in[16]) {
   uint32x4_t out;
   for (int i = 0; i < 16; i++)
@@ -100,6 +125,68 @@ static inline void duplex_put(uint8_t out[16], uint32x4_t in) {
     out[i] = duplex_byte(&in, i);
 }
 
+#ifdef duplex_masked
+
+/* Masked loads and stores start at the buffer itself and a byte shuffle
+   moves the data to or from its offset, so no pointer strays outside it */
+
+__attribute__((target("avx512bw,avx512vl")))
+static inline uint32x4_t duplex_load_masked(const uint8_t *in,
+    uint8_t offset, uint8_t length) {
+  __m128i index = _mm_set_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+    7, 6, 5, 4, 3, 2, 1, 0);
+  __m128i bytes = _mm_maskz_loadu_epi8((1 << length) - 1, in);
+  index = _mm_sub_epi8(index, _mm_set1_epi8(offset));
+  return (uint32x4_t) _mm_shuffle_epi8(bytes, index);
+}
+
+__attribute__((target("avx512bw,avx512vl")))
+static inline void duplex_store_masked(uint8_t *out, uint32x4_t in,
+    uint8_t offset, uint8_t length) {
+  __m128i index = _mm_set_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+    7, 6, 5, 4, 3, 2, 1, 0);
+  index = _mm_add_epi8(index, _mm_set1_epi8(offset));
+  in = (uint32x4_t) _mm_shuffle_epi8((__m128i) in, index);
+  _mm_mask_storeu_epi8(out, (1 << length) - 1, (__m128i) in);
+}
+
+#endif
+
+static inline uint32x4_t duplex_load(const uint8_t *in, uint8_t offset,
+    uint8_t length) {
+#ifdef duplex_masked
+  if (duplex_masked)
+    return duplex_load_masked(in, offset, length);
+#endif
+
+  uint32x4_t out = { 0 };
+  for (int i = 0; i < length; i++)
+    duplex_byte(&out, offset + i) = in[i];
+  return out;
+}
+
+static inline void duplex_store(uint8_t *out, uint32x4_t in, uint8_t offset,
+    uint8_t length) {
+#ifdef duplex_masked
+  if (duplex_masked) {
+    duplex_store_masked(out, in, offset, length);
+    return;
+  }
+#endif
+
+  for (int i = 0; i < length; i++)
+    out[i] = duplex_byte(&in, offset + i);
+}
+
+static inline uint32x4_t duplex_mask(uint8_t offset, uint8_t length) {
+  const uint8_t index[16] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+  };
+  uint8x16_t bytes = (uint8x16_t) duplex_get(index);
+  uint8_t end = offset + length;
+  return (uint32x4_t) ((bytes >= offset) & (bytes < end));
+}
+
 static inline void duplex_absorb(duplex_t state, const void *data,
     size_t length) {
   const uint8_t *bytes = data;
@@ -108,12 +195,11 @@ static inline void duplex_absorb(duplex_t state, const void *data,
 
   while (1) {
     if (length < 16 || offset > 0) {
-      for (int i = offset; i < 16; i++, length--) {
-        if (length == 0)
-          return;
-        duplex_byte(state, i) ^= bytes[i - offset];
-      }
-      bytes += 16 - offset, offset = 0;
+      uint8_t chunk = length < 16u - offset ? length : 16 - offset;
+      state[0] ^= duplex_load(bytes, offset, chunk);
+      if (offset + chunk < 16)
+        return;
+      bytes += chunk, length -= chunk, offset = 0;
       duplex_permute(state);
     }
 
@@ -142,13 +228,14 @@ static inline void duplex_decrypt(duplex_t state, void *data,
 
   while (1) {
     if (length < 16 || offset > 0) {
-      for (int i = offset; i < 16; i++, length--) {
-        if (length == 0)
-          return;
-        bytes[i - offset] ^= duplex_byte(state, i);
-        duplex_byte(state, i) ^= bytes[i - offset];
-      }
-      bytes += 16 - offset, offset = 0;
+      uint8_t chunk = length < 16u - offset ? length : 16 - offset;
+      uint32x4_t words = duplex_load(bytes, offset, chunk);
+      duplex_store(bytes, words ^ state[0], offset, chunk);
+      state[0] &= ~duplex_mask(offset, chunk);
+      state[0] |= words;
+      if (offset + chunk < 16)
+        return;
+      bytes += chunk, length -= chunk, offset = 0;
       duplex_permute(state);
     }
 
@@ -169,13 +256,12 @@ static inline void duplex_encrypt(duplex_t state, void *data,
 
   while (1) {
     if (length < 16 || offset > 0) {
-      for (int i = offset; i < 16; i++, length--) {
-        if (length == 0)
-          return;
-        duplex_byte(state, i) ^= bytes[i - offset];
-        bytes[i - offset] = duplex_byte(state, i);
-      }
-      bytes += 16 - offset, offset = 0;
+      uint8_t chunk = length < 16u - offset ? length : 16 - offset;
+      state[0] ^= duplex_load(bytes, offset, chunk);
+      duplex_store(bytes, state[0], offset, chunk);
+      if (offset + chunk < 16)
+        return;
+      bytes += chunk, length -= chunk, offset = 0;
       duplex_permute(state);
     }
 
@@ -201,11 +287,9 @@ static inline void duplex_ratchet(duplex_t state) {
   uint8_t offset = duplex_counter(state) & 15;
   duplex_counter(state) += 16;
 
-  for (int i = offset; i < 16; i++)
-    duplex_byte(state, i) = 0;
+  state[0] &= duplex_mask(0, offset);
   duplex_permute(state);
-  for (int i = 0; i < offset; i++)
-    duplex_byte(state, i) = 0;
+  state[0] &= ~duplex_mask(0, offset);
 }
 
 static inline void duplex_squeeze(duplex_t state, void *data,
@@ -215,12 +299,11 @@ static inline void duplex_squeeze(duplex_t state, void *data,
 
   while (1) {
     if (length < 16 || offset > 0) {
-      for (int i = offset; i < 16; i++, length--) {
-        if (length == 0)
-          return;
-        bytes[i - offset] = duplex_byte(state, i);
-      }
-      bytes += 16 - offset, offset = 0;
+      uint8_t chunk = length < 16u - offset ? length : 16 - offset;
+      duplex_store(bytes, state[0], offset, chunk);
+      if (offset + chunk < 16)
+        return;
+      bytes += chunk, length -= chunk, offset = 0;
       duplex_permute(state);
     }
 
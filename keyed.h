@@ -0,0 +1,157 @@
+/* keyed.h from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
+
+#ifndef KEYED_H
+#define KEYED_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duplex.h"
+
+#ifndef duplex_keyed_rate
+#define duplex_keyed_rate 32
+#endif
+
+#ifndef duplex_keyed_permute
+#define duplex_keyed_permute duplex_permute
+#endif
+
+#if duplex_keyed_rate < 16 || duplex_keyed_rate > 32
+#error Keyed duplex rate must be between 16 and 32 bytes
+#endif
+
+static inline size_t duplex_keyed_chunk(size_t offset, size_t length) {
+  size_t chunk = 16 - (offset & 15);
+  if (chunk > duplex_keyed_rate - offset)
+    chunk = duplex_keyed_rate - offset;
+  return chunk < length ? chunk : length;
+}
+
+static inline void duplex_keyed_clear(duplex_t state, size_t offset,
+    size_t length) {
+  while (length > 0) {
+    size_t chunk = duplex_keyed_chunk(offset, length);
+    state[offset >> 4] &= ~duplex_mask(offset & 15, chunk);
+    offset += chunk, length -= chunk;
+  }
+}
+
+static inline void duplex_keyed(duplex_t state) {
+  duplex_pad(state);
+  duplex_counter(state) += (duplex_keyed_rate - duplex_counter(state)
+    % duplex_keyed_rate) % duplex_keyed_rate;
+}
+
+static inline void duplex_keyed_absorb(duplex_t state, const void *data,
+    size_t length) {
+  const uint8_t *bytes = data;
+  size_t offset = duplex_counter(state) % duplex_keyed_rate;
+  duplex_counter(state) += length;
+
+  while (1) {
+    size_t chunk = duplex_keyed_chunk(offset, length);
+    if (chunk == 16)
+      state[offset >> 4] ^= duplex_get(bytes);
+    else
+      state[offset >> 4] ^= duplex_load(bytes, offset & 15, chunk);
+    bytes += chunk, length -= chunk, offset += chunk;
+
+    if (offset == duplex_keyed_rate)
+      duplex_keyed_permute(state), offset = 0;
+    else if (length == 0)
+      return;
+  }
+}
+
+static inline void duplex_keyed_decrypt(duplex_t state, void *data,
+    size_t length) {
+  uint8_t *bytes = data;
+  size_t offset = duplex_counter(state) % duplex_keyed_rate;
+  duplex_counter(state) += length;
+
+  while (1) {
+    size_t chunk = duplex_keyed_chunk(offset, length);
+    uint32x4_t *rate = state + (offset >> 4);
+    if (chunk == 16) {
+      uint32x4_t words = duplex_get(bytes);
+      duplex_put(bytes, words ^ *rate);
+      *rate = words;
+    } else {
+      uint32x4_t words = duplex_load(bytes, offset & 15, chunk);
+      duplex_store(bytes, words ^ *rate, offset & 15, chunk);
+      *rate &= ~duplex_mask(offset & 15, chunk);
+      *rate |= words;
+    }
+    bytes += chunk, length -= chunk, offset += chunk;
+
+    if (offset == duplex_keyed_rate)
+      duplex_keyed_permute(state), offset = 0;
+    else if (length == 0)
+      return;
+  }
+}
+
+static inline void duplex_keyed_encrypt(duplex_t state, void *data,
+    size_t length) {
+  uint8_t *bytes = data;
+  size_t offset = duplex_counter(state) % duplex_keyed_rate;
+  duplex_counter(state) += length;
+
+  while (1) {
+    size_t chunk = duplex_keyed_chunk(offset, length);
+    uint32x4_t *rate = state + (offset >> 4);
+    if (chunk == 16) {
+      *rate ^= duplex_get(bytes);
+      duplex_put(bytes, *rate);
+    } else {
+      *rate ^= duplex_load(bytes, offset & 15, chunk);
+      duplex_store(bytes, *rate, offset & 15, chunk);
+    }
+    bytes += chunk, length -= chunk, offset += chunk;
+
+    if (offset == duplex_keyed_rate)
+      duplex_keyed_permute(state), offset = 0;
+    else if (length == 0)
+      return;
+  }
+}
+
+static inline void duplex_keyed_pad(duplex_t state) {
+  size_t offset = duplex_counter(state) % duplex_keyed_rate;
+  duplex_counter(state) += duplex_keyed_rate - offset;
+
+  duplex_byte(state, offset) ^= 1;
+  duplex_byte(state, 47) ^= 1;
+  duplex_keyed_permute(state);
+}
+
+static inline void duplex_keyed_ratchet(duplex_t state) {
+  size_t offset = duplex_counter(state) % duplex_keyed_rate;
+  duplex_counter(state) += duplex_keyed_rate;
+
+  duplex_keyed_clear(state, offset, duplex_keyed_rate - offset);
+  duplex_keyed_permute(state);
+  duplex_keyed_clear(state, 0, offset);
+}
+
+static inline void duplex_keyed_squeeze(duplex_t state, void *data,
+    size_t length) {
+  uint8_t *bytes = data;
+  size_t offset = duplex_counter(state) % duplex_keyed_rate;
+  duplex_counter(state) += length;
+
+  while (1) {
+    size_t chunk = duplex_keyed_chunk(offset, length);
+    if (chunk == 16)
+      duplex_put(bytes, state[offset >> 4]);
+    else
+      duplex_store(bytes, state[offset >> 4], offset & 15, chunk);
+    bytes += chunk, length -= chunk, offset += chunk;
+
+    if (offset == duplex_keyed_rate)
+      duplex_keyed_permute(state), offset = 0;
+    else if (length == 0)
+      return;
+  }
+}
+
+#endif
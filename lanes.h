@@ -0,0 +1,289 @@
+/* lanes.h from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
+
+#ifndef LANES_H
+#define LANES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duplex.h"
+
+#ifndef duplex_lanes
+#if defined __AVX512F__
+#define duplex_lanes 16
+#elif defined __AVX2__
+#define duplex_lanes 8
+#else
+#define duplex_lanes 4
+#endif
+#endif
+
+#define duplex_lanes_paste(permute) permute##_lanes
+#define duplex_lanes_expand(permute) duplex_lanes_paste(permute)
+
+#ifndef duplex_permute_lanes
+#define duplex_permute_lanes duplex_lanes_expand(duplex_permute)
+#endif
+
+typedef uint32_t duplex_lane_t
+  __attribute__((vector_size(duplex_lanes * sizeof(uint32_t))));
+
+static inline void duplex_gimli_lanes(duplex_lane_t state[12]) {
+  for (int round = 24; round > 0; round--) {
+    for (int i = 0; i < 4; i++) {
+      duplex_lane_t x = state[i] << 24 | state[i] >> 8;
+      duplex_lane_t y = state[i + 4] << 9 | state[i + 4] >> 23;
+      duplex_lane_t z = state[i + 8];
+
+      state[i + 8] = x ^ (z << 1) ^ ((y & z) << 2);
+      state[i + 4] = y ^ x ^ ((x | z) << 1);
+      state[i] = z ^ y ^ ((x & y) << 3);
+    }
+
+    duplex_lane_t t;
+    switch (round & 3) {
+      case 0:
+        t = state[0], state[0] = state[1], state[1] = t;
+        t = state[2], state[2] = state[3], state[3] = t;
+        state[0] ^= 0x9e377900 | round;
+        break;
+      case 2:
+        t = state[0], state[0] = state[2], state[2] = t;
+        t = state[1], state[1] = state[3], state[3] = t;
+        break;
+    }
+  }
+}
+
+static inline void duplex_xoodoo_rounds_lanes(duplex_lane_t state[12],
+    int rounds) {
+  const uint32_t rk[12] = {
+    0x058, 0x038, 0x3c0, 0x0d0, 0x120, 0x014,
+    0x060, 0x02c, 0x380, 0x0f0, 0x1a0, 0x012
+  };
+
+  for (int round = 12 - rounds; round < 12; round++) {
+    duplex_lane_t p[4], x[4], y[4], z[4];
+    for (int i = 0; i < 4; i++)
+      p[i] = state[i] ^ state[i + 4] ^ state[i + 8];
+    for (int i = 0; i < 4; i++) {
+      duplex_lane_t e = p[(i + 3) & 3];
+      e = (e << 5 | e >> 27) ^ (e << 14 | e >> 18);
+      state[i] ^= e, state[i + 4] ^= e, state[i + 8] ^= e;
+    }
+
+    for (int i = 0; i < 4; i++) {
+      x[i] = state[i];
+      y[i] = state[((i + 3) & 3) + 4];
+      z[i] = state[i + 8] << 11 | state[i + 8] >> 21;
+    }
+    x[0] ^= rk[round];
+
+    for (int i = 0; i < 4; i++) {
+      state[i] = x[i] ^ (~y[i] & z[i]);
+      state[i + 4] = y[i] ^ (~z[i] & x[i]);
+      z[i] ^= ~x[i] & y[i];
+    }
+
+    for (int i = 0; i < 4; i++) {
+      state[i + 4] = state[i + 4] << 1 | state[i + 4] >> 31;
+      state[i + 8] = z[(i + 2) & 3] << 8 | z[(i + 2) & 3] >> 24;
+    }
+  }
+}
+
+static inline void duplex_xoodoo_lanes(duplex_lane_t state[12]) {
+  duplex_xoodoo_rounds_lanes(state, 12);
+}
+
+static inline void duplex_xoodoo6_lanes(duplex_lane_t state[12]) {
+  duplex_xoodoo_rounds_lanes(state, 6);
+}
+
+static inline void duplex_gather(duplex_lane_t lanes[12],
+    uint32x4_t *state[], size_t count) {
+  for (int i = 0; i < 12; i++)
+    lanes[i] = (duplex_lane_t) { 0 };
+  for (size_t j = 0; j < count && j < duplex_lanes; j++)
+    for (int i = 0; i < 12; i++)
+      lanes[i][j] = state[j][i >> 2][i & 3];
+}
+
+static inline void duplex_scatter(uint32x4_t *state[],
+    const duplex_lane_t lanes[12], size_t count) {
+  for (size_t j = 0; j < count && j < duplex_lanes; j++)
+    for (int i = 0; i < 12; i++)
+      state[j][i >> 2][i & 3] = lanes[i][j];
+}
+
+static inline void duplex_lanes_many(uint32x4_t *state[], size_t count,
+    void (*permute)(duplex_lane_t [12])) {
+  duplex_lane_t lanes[12];
+
+  for (size_t i = 0; i < count; i += duplex_lanes) {
+    duplex_gather(lanes, state + i, count - i);
+    permute(lanes);
+    duplex_scatter(state + i, lanes, count - i);
+  }
+}
+
+static inline void duplex_permute_many(uint32x4_t *state[], size_t count) {
+  duplex_lanes_many(state, count, duplex_permute_lanes);
+}
+
+enum {
+  duplex_absorbing,
+  duplex_decrypting,
+  duplex_encrypting,
+  duplex_squeezing,
+  duplex_opening,
+  duplex_sealing
+};
+
+static inline void duplex_lane(uint32x4_t *rate, uint8_t *bytes,
+    uint8_t offset, uint8_t length, int mode) {
+  if (offset == 0 && length == 16) {
+    uint32x4_t words = { 0 };
+    if (mode != duplex_squeezing)
+      words = duplex_get(bytes);
+    if (mode != duplex_absorbing)
+      duplex_put(bytes, *rate ^ words);
+    *rate = mode == duplex_decrypting ? words : *rate ^ words;
+    return;
+  }
+
+  if (length == 0)
+    return;
+
+  uint32x4_t words = { 0 };
+  if (mode != duplex_squeezing)
+    words = duplex_load(bytes, offset, length);
+  if (mode != duplex_absorbing)
+    duplex_store(bytes, *rate ^ words, offset, length);
+  if (mode == duplex_decrypting)
+    *rate &= ~duplex_mask(offset, length);
+  *rate ^= words;
+}
+
+static inline int duplex_many(uint32x4_t *state[], uint8_t *const data[],
+    const size_t length[], int result[], size_t count, int mode) {
+  duplex_lane_t lanes[12];
+  uint32x4_t rate[duplex_lanes];
+  size_t job[duplex_lanes], left[duplex_lanes], next = 0;
+  uint8_t *bytes[duplex_lanes], offset[duplex_lanes], phase[duplex_lanes];
+  int failed = 0;
+
+  for (size_t j = 0; j < duplex_lanes; j++)
+    job[j] = count, rate[j] = (uint32x4_t) { 0 };
+
+  while (1) {
+    size_t busy = 0;
+
+    for (size_t j = 0; j < duplex_lanes; j++)
+      while (job[j] < count || next < count) {
+        if (job[j] == count) {
+          job[j] = next++, phase[j] = 0;
+          rate[j] = state[job[j]][0];
+          for (int i = 4; i < 12; i++)
+            lanes[i][j] = state[job[j]][i >> 2][i & 3];
+          bytes[j] = data[job[j]], left[j] = length[job[j]];
+          offset[j] = duplex_counter(state[job[j]]) & 15;
+          duplex_counter(state[job[j]]) += left[j];
+        }
+
+        if (phase[j] == 0) {
+          uint8_t chunk = left[j] < 16u - offset[j] ? left[j] : 16 - offset[j];
+          duplex_lane(&rate[j], bytes[j], offset[j], chunk,
+            mode == duplex_opening ? duplex_decrypting :
+            mode == duplex_sealing ? duplex_encrypting : mode);
+          bytes[j] += chunk, left[j] -= chunk, offset[j] += chunk;
+
+          if (offset[j] == 16) {
+            offset[j] = 0, busy++;
+            break;
+          }
+
+          if (mode == duplex_opening || mode == duplex_sealing) {
+            duplex_counter(state[job[j]]) += 16 - offset[j];
+            duplex_byte(&rate[j], offset[j]) ^= 1;
+            lanes[11][j] ^= 1 << 24;
+            offset[j] = 0, phase[j] = 1, busy++;
+            break;
+          }
+        } else if (phase[j] == 1) {
+          duplex_counter(state[job[j]]) += duplex_rate;
+          duplex_lane(&rate[j], bytes[j], 0, duplex_rate,
+            mode == duplex_opening ? duplex_decrypting : duplex_squeezing);
+          phase[j] = 2, busy++;
+          break;
+        }
+
+        if (mode == duplex_opening) {
+          int check = duplex_compare(bytes[j], 0, duplex_rate);
+          if (result)
+            result[job[j]] = check;
+          failed |= check;
+        }
+
+        state[job[j]][0] = rate[j];
+        for (int i = 4; i < 12; i++)
+          state[job[j]][i >> 2][i & 3] = lanes[i][j];
+        job[j] = count;
+      }
+
+    if (busy == 0)
+      return failed;
+
+    for (int i = 0; i < 4; i++)
+      for (size_t j = 0; j < duplex_lanes; j++)
+        lanes[i][j] = rate[j][i];
+    duplex_permute_lanes(lanes);
+    for (size_t j = 0; j < duplex_lanes; j++)
+      for (int i = 0; i < 4; i++)
+        rate[j][i] = lanes[i][j];
+  }
+}
+
+static inline void duplex_absorb_many(uint32x4_t *state[],
+    const uint8_t *const data[], const size_t length[], size_t count) {
+  /* duplex_many() only reads the data when absorbing */
+  duplex_many(state, (uint8_t *const *) data, length, 0, count,
+    duplex_absorbing);
+}
+
+static inline void duplex_decrypt_many(uint32x4_t *state[],
+    uint8_t *const data[], const size_t length[], size_t count) {
+  duplex_many(state, data, length, 0, count, duplex_decrypting);
+}
+
+static inline void duplex_encrypt_many(uint32x4_t *state[],
+    uint8_t *const data[], const size_t length[], size_t count) {
+  duplex_many(state, data, length, 0, count, duplex_encrypting);
+}
+
+static inline int duplex_open_many(uint32x4_t *state[],
+    uint8_t *const data[], const size_t length[], int result[],
+    size_t count) {
+  return duplex_many(state, data, length, result, count, duplex_opening);
+}
+
+static inline void duplex_pad_many(uint32x4_t *state[], size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    uint8_t offset = duplex_counter(state[i]) & 15;
+    duplex_counter(state[i]) += 16 - offset;
+    duplex_byte(state[i], offset) ^= 1;
+    duplex_byte(state[i], 47) ^= 1;
+  }
+  duplex_permute_many(state, count);
+}
+
+static inline void duplex_seal_many(uint32x4_t *state[],
+    uint8_t *const data[], const size_t length[], size_t count) {
+  duplex_many(state, data, length, 0, count, duplex_sealing);
+}
+
+static inline void duplex_squeeze_many(uint32x4_t *state[],
+    uint8_t *const data[], const size_t length[], size_t count) {
+  duplex_many(state, data, length, 0, count, duplex_squeezing);
+}
+
+#endif
@@ -0,0 +1,79 @@
+/* stream.h from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duplex.h"
+#include "lanes.h"
+#include "tree.h"
+
+enum {
+  duplex_stream_chunk = 65536,
+  duplex_stream_record = duplex_stream_chunk + duplex_rate,
+  duplex_stream_version = 1,
+  duplex_session = 3,
+  duplex_segment = 4
+};
+
+static inline void duplex_stream(duplex_t session) {
+  duplex_pad(session);
+  duplex_node(session, duplex_session, duplex_stream_version);
+}
+
+static inline uint64_t duplex_stream_chunks(uint64_t size) {
+  if (size % duplex_stream_record < duplex_rate)
+    return 0;
+  return size / duplex_stream_record + 1;
+}
+
+static inline uint64_t duplex_stream_length(uint64_t size) {
+  if (size % duplex_stream_record < duplex_rate)
+    return 0;
+  return size - (size / duplex_stream_record + 1) * duplex_rate;
+}
+
+static inline void duplex_stream_state(duplex_t state,
+    const duplex_t session, uint64_t index) {
+  __builtin_memcpy(state, session, duplex_size);
+  duplex_node(state, duplex_segment, index);
+}
+
+static inline void duplex_stream_seal(const duplex_t session,
+    uint8_t *const data[], const size_t length[], uint64_t index,
+    size_t count) {
+  duplex_t chunk[duplex_lanes];
+  uint32x4_t *state[duplex_lanes];
+
+  for (size_t i = 0; i < count; i += duplex_lanes) {
+    size_t lanes = count - i < duplex_lanes ? count - i : duplex_lanes;
+    for (size_t j = 0; j < lanes; j++) {
+      duplex_stream_state(chunk[j], session, index + i + j);
+      state[j] = chunk[j];
+    }
+    duplex_seal_many(state, data + i, length + i, lanes);
+  }
+  duplex_zero(chunk, sizeof(chunk));
+}
+
+static inline int duplex_stream_open(const duplex_t session,
+    uint8_t *const data[], const size_t length[], uint64_t index,
+    size_t count) {
+  duplex_t chunk[duplex_lanes];
+  uint32x4_t *state[duplex_lanes];
+  int result = 0;
+
+  for (size_t i = 0; i < count; i += duplex_lanes) {
+    size_t lanes = count - i < duplex_lanes ? count - i : duplex_lanes;
+    for (size_t j = 0; j < lanes; j++) {
+      duplex_stream_state(chunk[j], session, index + i + j);
+      state[j] = chunk[j];
+    }
+    result |= duplex_open_many(state, data + i, length + i, 0, lanes);
+  }
+  duplex_zero(chunk, sizeof(chunk));
+  return result;
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "duplex.h"
+#include "deck.h"
+
+static void fill(void *out1, void *out2, size_t length) {
+  static uint32_t seed = 0x12345678;
+  for (size_t i = 0; i < length; i++) {
+    seed += seed * seed | 5;
+    ((uint8_t *) out1)[i] = seed >> 24;
+    ((uint8_t *) out2)[i] = seed >> 24;
+  }
+}
+
+static void string(duplex_deck_t deck, const uint8_t *data, size_t length,
+    uint8_t frame) {
+  for (size_t i = 0; i <= length; i += duplex_deck_block) {
+    uint8_t block[duplex_deck_block] = { 0 };
+    uint32x4_t state[3];
+
+    if (length - i >= duplex_deck_block) {
+      memcpy(block, data + i, duplex_deck_block);
+    } else {
+      memcpy(block, data + i, length - i);
+      block[length - i] = frame;
+    }
+
+    for (int k = 0; k < 3; k++)
+      state[k] = duplex_get(block + 16 * k) ^ deck[k];
+    duplex_xoodoo6(state);
+    for (int k = 0; k < 3; k++)
+      deck[k + 3] ^= state[k];
+    duplex_deck_rollc(deck);
+  }
+  duplex_deck_rollc(deck);
+}
+
+static void stream(const duplex_deck_t deck, uint8_t *data, size_t length,
+    size_t offset) {
+  uint8_t block[duplex_deck_block];
+  uint32x4_t state[3], output[3];
+
+  for (int k = 0; k < 3; k++)
+    state[k] = deck[k + 3];
+  duplex_xoodoo6(state);
+
+  for (size_t i = 0; i < offset + length; i += duplex_deck_block) {
+    for (int k = 0; k < 3; k++)
+      output[k] = state[k];
+    duplex_xoodoo6(output);
+    for (int k = 0; k < 3; k++)
+      duplex_put(block + 16 * k, output[k] ^ deck[k]);
+    duplex_deck_rolle(state);
+
+    for (size_t j = 0; j < duplex_deck_block; j++)
+      if (i + j >= offset && i + j < offset + length)
+        data[i + j - offset] = block[j];
+  }
+}
+
+int main(void) {
+  const size_t size = 3 * duplex_lanes * duplex_deck_block + 64;
+  uint8_t buffer1[size + duplex_rate], buffer2[size + duplex_rate];
+  uint8_t buffer3[size + duplex_rate];
+  duplex_deck_t deck1, deck2, deck3;
+
+  /* Check batched compression matches block-at-a-time compression */
+  for (size_t length = 0; length <= size; length += 7) {
+    fill(buffer1, buffer2, length);
+    fill(deck1, deck2, duplex_deck_size);
+    duplex_deck_absorb(deck1, buffer1, length);
+    string(deck2, buffer2, length, 1);
+    if (memcmp(deck1, deck2, duplex_deck_size))
+      errx(EXIT_FAILURE, "Deck compression failure");
+  }
+
+  /* Check batched expansion matches block-at-a-time expansion */
+  for (size_t offset = 0; offset < 100; offset += 3)
+    for (size_t length = 0; length <= size; length += 29) {
+      fill(deck1, deck2, duplex_deck_size);
+      duplex_deck_stream(deck1, buffer1, length, offset, 0);
+      stream(deck2, buffer2, length, offset);
+      if (memcmp(buffer1, buffer2, length))
+        errx(EXIT_FAILURE, "Deck expansion failure");
+    }
+
+  /* Check sealed messages open, and modified messages are rejected */
+  for (size_t length = 0; length <= size; length += 13) {
+    fill(buffer1, buffer2, length);
+    duplex_deck_key(deck1, "key", 3);
+    duplex_deck_absorb(deck1, "nonce", 5);
+    memcpy(deck2, deck1, duplex_deck_size);
+    memcpy(deck3, deck1, duplex_deck_size);
+
+    duplex_deck_seal(deck1, buffer1, length);
+    if (length >= 4 && !memcmp(buffer1, buffer2, length))
+      errx(EXIT_FAILURE, "Deck encryption failure");
+
+    memcpy(buffer3, buffer1, length + duplex_rate);
+    buffer3[length / 2] ^= 1;
+    if (duplex_deck_open(deck2, buffer1, length))
+      errx(EXIT_FAILURE, "Deck authentication failure");
+    if (memcmp(buffer1, buffer2, length))
+      errx(EXIT_FAILURE, "Deck decryption failure");
+    if (!duplex_deck_open(deck3, buffer3, length))
+      errx(EXIT_FAILURE, "Deck authentication failure");
+  }
+
+  /* Check a session of sealed messages opens in order */
+  duplex_deck_key(deck1, "key", 3);
+  memcpy(deck2, deck1, duplex_deck_size);
+  for (size_t length = 0; length <= size; length += 97) {
+    fill(buffer1, buffer2, length);
+    duplex_deck_absorb(deck1, "header", 6);
+    duplex_deck_seal(deck1, buffer1, length);
+    duplex_deck_absorb(deck2, "header", 6);
+    if (duplex_deck_open(deck2, buffer1, length))
+      errx(EXIT_FAILURE, "Deck session failure");
+    if (memcmp(buffer1, buffer2, length))
+      errx(EXIT_FAILURE, "Deck session failure");
+  }
+
+  /* Check long keys are not truncated or confused with short ones */
+  fill(buffer1, buffer2, 2 * duplex_deck_block);
+  for (size_t length = 0; length <= 2 * duplex_deck_block; length++) {
+    duplex_deck_key(deck1, buffer1, length);
+    for (size_t other = 0; other < length; other++) {
+      duplex_deck_key(deck2, buffer1, other);
+      if (!memcmp(deck1, deck2, duplex_deck_size))
+        errx(EXIT_FAILURE, "Deck key collision");
+    }
+  }
+
+  printf("Deck function operations sanity-checked\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "duplex.h"
+#include "deck.h"
+
+static duplex_deck_t deck;
+static uint8_t buffer[65536 + duplex_rate];
+
+static double speed(void (*operation)(void), size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    operation();
+  double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  return (double) repeat * (sizeof(buffer) - duplex_rate) / seconds
+    / (1 << 20);
+}
+
+static void absorb(void) {
+  duplex_deck_absorb(deck, buffer, sizeof(buffer) - duplex_rate);
+}
+
+static void squeeze(void) {
+  duplex_deck_squeeze(deck, buffer, sizeof(buffer) - duplex_rate);
+}
+
+static void seal(void) {
+  duplex_deck_seal(deck, buffer, sizeof(buffer) - duplex_rate);
+}
+
+static void open(void) {
+  duplex_deck_open(deck, buffer, sizeof(buffer) - duplex_rate);
+}
+
+int main(void) {
+  duplex_deck_key(deck, "key", 3);
+  speed(absorb, 512); /* warm up any dynamic CPU frequency scaling */
+  printf("Xoodoo deck absorbs at %0.1f MB/s\n", speed(absorb, 1024));
+  printf("Xoodoo deck squeezes at %0.1f MB/s\n", speed(squeeze, 1024));
+  printf("Xoodoo deck seals at %0.1f MB/s\n", speed(seal, 1024));
+  printf("Xoodoo deck opens at %0.1f MB/s\n\n", speed(open, 1024));
+  return EXIT_SUCCESS;
+}
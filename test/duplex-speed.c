@@ -15,6 +15,13 @@ static double permute(size_t repeat) {
   return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat;
 }
 
+static double permute6(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    duplex_xoodoo6(state);
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
 static double speed(void (*operation)(void), size_t repeat) {
   clock_t start = clock();
   for (size_t i = 0; i < repeat; i++)
@@ -23,6 +30,17 @@ static double speed(void (*operation)(void), size_t repeat) {
   return (double) repeat * sizeof(buffer) / seconds / (1 << 20);
 }
 
+static double partial(void (*operation)(size_t), size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    for (uint8_t offset = 0; offset < 16; offset++)
+      for (size_t length = 0; length < 64; length++) {
+        duplex_counter(state) = offset;
+        operation(length);
+      }
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat / 1024;
+}
+
 static void absorb(void) {
   duplex_absorb(state, buffer, sizeof(buffer));
 }
@@ -39,16 +57,41 @@ static void decrypt(void) {
   duplex_decrypt(state, buffer, sizeof(buffer));
 }
 
+static void absorb_partial(size_t length) {
+  duplex_absorb(state, buffer, length);
+}
+
+static void squeeze_partial(size_t length) {
+  duplex_squeeze(state, buffer, length);
+}
+
+static void encrypt_partial(size_t length) {
+  duplex_encrypt(state, buffer, length);
+}
+
+static void decrypt_partial(size_t length) {
+  duplex_decrypt(state, buffer, length);
+}
+
 int main(void) {
   for (size_t i = 0; i < sizeof(buffer); i++)
     buffer[i] = (uint8_t) i;
 
   permute(1 << 20); /* warm up any dynamic CPU frequency scaling */
   printf("Xoodoo permutes in %0.1f ns\n", permute(1 << 21));
+  printf("6-round Xoodoo permutes in %0.1f ns\n", permute6(1 << 21));
   printf("Xoodoo duplex absorbs at %0.1f MB/s\n", speed(absorb, 512));
   printf("Xoodoo duplex squeezes at %0.1f MB/s\n", speed(squeeze, 512));
   printf("Xoodoo duplex encrypts at %0.1f MB/s\n", speed(encrypt, 512));
-  printf("Xoodoo duplex decrypts at %0.1f MB/s\n\n", speed(decrypt, 512));
+  printf("Xoodoo duplex decrypts at %0.1f MB/s\n", speed(decrypt, 512));
+  printf("Xoodoo duplex absorbs 0-63 bytes in %0.1f ns\n",
+    partial(absorb_partial, 4096));
+  printf("Xoodoo duplex squeezes 0-63 bytes in %0.1f ns\n",
+    partial(squeeze_partial, 4096));
+  printf("Xoodoo duplex encrypts 0-63 bytes in %0.1f ns\n",
+    partial(encrypt_partial, 4096));
+  printf("Xoodoo duplex decrypts 0-63 bytes in %0.1f ns\n\n",
+    partial(decrypt_partial, 4096));
 
   return EXIT_SUCCESS;
 }
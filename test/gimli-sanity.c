@@ -46,6 +46,44 @@ static void chunk_squeeze(duplex_t state, uint8_t *buffer, size_t length,
   duplex_squeeze(state, buffer, length);
 }
 
+static void byte_absorb(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    uint8_t offset = duplex_counter(state)++ & 15;
+    duplex_byte(state, offset) ^= buffer[i];
+    if (offset == 15)
+      duplex_permute(state);
+  }
+}
+
+static void byte_decrypt(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    uint8_t offset = duplex_counter(state)++ & 15;
+    buffer[i] ^= duplex_byte(state, offset);
+    duplex_byte(state, offset) ^= buffer[i];
+    if (offset == 15)
+      duplex_permute(state);
+  }
+}
+
+static void byte_encrypt(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    uint8_t offset = duplex_counter(state)++ & 15;
+    duplex_byte(state, offset) ^= buffer[i];
+    buffer[i] = duplex_byte(state, offset);
+    if (offset == 15)
+      duplex_permute(state);
+  }
+}
+
+static void byte_squeeze(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    uint8_t offset = duplex_counter(state)++ & 15;
+    buffer[i] = duplex_byte(state, offset);
+    if (offset == 15)
+      duplex_permute(state);
+  }
+}
+
 static void fill(void *out1, void *out2, size_t length) {
   static uint32_t seed = 0x12345678;
   for (size_t i = 0; i < length; i++) {
@@ -112,6 +150,30 @@ int main(void) {
       errx(EXIT_FAILURE, "Streaming squeeze failure");
   }
 
+  /* Check partial operations at every offset match byte-at-a-time ones */
+  for (uint8_t offset = 0; offset < 16; offset++)
+    for (size_t length = 0; length < 64; length++) {
+      void (*bulk[])(duplex_t, void *, size_t) = {
+        (void (*)(duplex_t, void *, size_t)) duplex_absorb,
+        duplex_decrypt, duplex_encrypt, duplex_squeeze
+      };
+      void (*bytes[])(duplex_t, uint8_t *, size_t) = {
+        byte_absorb, byte_decrypt, byte_encrypt, byte_squeeze
+      };
+
+      for (int i = 0; i < 4; i++) {
+        fill(buffer1, buffer2, length + 16);
+        fill(state1, state2, duplex_size);
+        duplex_counter(state1) = duplex_counter(state2) = offset;
+        bulk[i](state1, buffer1 + 8, length);
+        bytes[i](state2, buffer2 + 8, length);
+        if (memcmp(buffer1, buffer2, length + 16))
+          errx(EXIT_FAILURE, "Partial operation failure");
+        if (memcmp(state1, state2, duplex_size))
+          errx(EXIT_FAILURE, "Partial operation failure");
+      }
+    }
+
   printf("Streaming duplex operations sanity-checked\n");
   return EXIT_SUCCESS;
 }
@@ -23,6 +23,17 @@ static double speed(void (*operation)(void), size_t repeat) {
   return (double) repeat * sizeof(buffer) / seconds / (1 << 20);
 }
 
+static double partial(void (*operation)(size_t), size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    for (uint8_t offset = 0; offset < 16; offset++)
+      for (size_t length = 0; length < 64; length++) {
+        duplex_counter(state) = offset;
+        operation(length);
+      }
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat / 1024;
+}
+
 static void absorb(void) {
   duplex_absorb(state, buffer, sizeof(buffer));
 }
@@ -39,6 +50,22 @@ static void decrypt(void) {
   duplex_decrypt(state, buffer, sizeof(buffer));
 }
 
+static void absorb_partial(size_t length) {
+  duplex_absorb(state, buffer, length);
+}
+
+static void squeeze_partial(size_t length) {
+  duplex_squeeze(state, buffer, length);
+}
+
+static void encrypt_partial(size_t length) {
+  duplex_encrypt(state, buffer, length);
+}
+
+static void decrypt_partial(size_t length) {
+  duplex_decrypt(state, buffer, length);
+}
+
 int main(void) {
   for (size_t i = 0; i < sizeof(buffer); i++)
     buffer[i] = (uint8_t) i;
@@ -48,7 +75,15 @@ int main(void) {
   printf("Gimli duplex absorbs at %0.1f MB/s\n", speed(absorb, 512));
   printf("Gimli duplex squeezes at %0.1f MB/s\n", speed(squeeze, 512));
   printf("Gimli duplex encrypts at %0.1f MB/s\n", speed(encrypt, 512));
-  printf("Gimli duplex decrypts at %0.1f MB/s\n\n", speed(decrypt, 512));
+  printf("Gimli duplex decrypts at %0.1f MB/s\n", speed(decrypt, 512));
+  printf("Gimli duplex absorbs 0-63 bytes in %0.1f ns\n",
+    partial(absorb_partial, 4096));
+  printf("Gimli duplex squeezes 0-63 bytes in %0.1f ns\n",
+    partial(squeeze_partial, 4096));
+  printf("Gimli duplex encrypts 0-63 bytes in %0.1f ns\n",
+    partial(encrypt_partial, 4096));
+  printf("Gimli duplex decrypts 0-63 bytes in %0.1f ns\n\n",
+    partial(decrypt_partial, 4096));
 
   return EXIT_SUCCESS;
 }
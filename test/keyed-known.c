@@ -0,0 +1,165 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define duplex_keyed_rate 32
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "keyed.h"
+
+const char *tags[] = {
+  "4552e12c71565dbb6a174e68c386f09c",
+  "2e8ab01cae6adac167d1f44eb6ae1cb9",
+  "ac8243a570f675ca01724b05aa09e6d4",
+  "255816a808c48d841f7c9b536f6b2ef3",
+  "d3efb1065da1adeaad7adff313438e91",
+  "88ed8c0bdd4df834d795a4bb8a1bc96e",
+  "84c8c25b79710607e08c74d961a518ee",
+  "412897fbe3cd993f8d3ae84ca1dc8d50",
+  "24b37f4e7e5f1e7286a4b4403d153b9f",
+  "6fa1e995f7539240a4b624371ffa9310",
+  "bdfc033bfc67865255e58fcda93efa7c",
+  "26eca5303772c7480132c9c6d3d8348a",
+  "807221e51f5c14169a6bc164348638a5",
+  "d704849afd36073c42fc17958e6cd6cf",
+  "2dec72b89d58cfbca2b815c4ecb47d4d",
+  "7cdf15c427a8e7bf37a3c7e021758019",
+  "18a7e2d459cb127b450a08122f74de85",
+  "cf8b139328171475de34f16bc8cf1299",
+  "0b7708a1ab55c3c6a0cb8d2f0aa8bed7",
+  "fbc4875463e719865ab7c4f28b52f098",
+  "a456938cfb9bea2f221fe3bc0288cda0",
+  "d5d67e3b6481f6321c33eead47e125ad",
+  "6c214b1432b264ef62d23eee330544f7",
+  "edacac77abbfb07239b917cc7738aa41",
+  "d2faa034dd8c8652b0e214afe2178ac5",
+  "4913dcfcfdee6c2677cf70eb50d593dd",
+  "3a18b69288642a62104c63f9413b6848",
+  "d6c2e2ed249d0ea146f033795b53002a",
+  "aab482a28b921c68c5f6b5b62eed69e6",
+  "c34254ada11b8a1234ceae3f3cd8b4d2",
+  "d3e551b26a4bceabd382d7c0700b2659",
+  "9a5bef7f11b193eeea22d9f634080a0b",
+  "fa9a4dd71a81ee14a234b0d1890c3e11",
+  "0bc4ebc11ed2f441afdbee9440a8536f",
+  "81772ea9b2afec5f7ed6a02aafc50d13",
+  "8192437574bb577861c9b6d759d61376",
+  "1392d5b8b424b3a80c51b12b37bbfbd6",
+  "dfba43d243ec96950cdac6a0172e3d68",
+  "feefcb50e116a88fdf1513a96e55017b",
+  "315b3d078fc467e0998942977c9810e2",
+  "a88635a7b8e923e4c61eefa40f5e254e",
+  "f28541a97cbd1101d4a31df3b78c2a60",
+  "f710bb83dfec82dcd6fd8d974eece68d",
+  "00987e6619f1b11b595f16f2be11a826",
+  "b08594702ed6659e6db87df821459a57",
+  "ea1a059fb0100ec343100e19e6e9e4b3",
+  "c7ec3d6b838584ac2ae14d75e99a8af7",
+  "70aa23cbf57e2f9bea6fa404fb664a26",
+  "1a73ca606cee258758d5245ed7c8c6ac",
+  "98ff4c02cf2ec58e3b2c99cde5851ceb",
+  "3cfce1587250eabb7679d4b56735d27c",
+  "ed4d32bfd340f5ca2fdbc866f24b707d",
+  "2bf427ca0a2ae161bd7190917f50dade",
+  "17a909b880d32c990b538b4a95ffc60e",
+  "7cdf0e800b47f17b9c87625ff47df498",
+  "9cd652dc121b23d53fd126472c6bef92",
+  "8f8bbcbf8ed5f650c4a9416716cb50f6",
+  "42a8aab4c2d32cf3c97a281f371c92fb",
+  "4c4ead622e22e704cd52f6cd3e817497",
+  "d49a3c5f7eccb89ebaa82eead2ba1e9c",
+  "79e65cd5c96fef97615a5ae0758afe32",
+  "072a690497562cebfc59438342efd0b0",
+  "0dbc9a584796e84c95d312b74f0294ec",
+  "18415a6ce5d2234fd77a21f0cc0d7ca9",
+  "14cbd9cfc2d01a5399921e8886f717a9",
+  "58ad54ea782c286e4fa28f471bad519f",
+  "c62452731e48aef307fa947598d3a2c1",
+  "bb9c46a57317d42a3fc804393c01f534",
+  "3017b9f685dfbacf48cfce8f5968ddb5",
+  "333cfd363f8305ec098e873f3a044645",
+  "8c97052638da4d504f80d8e25e1126d4",
+  "c460d8aa8bcc9abc068e706ab76682b5",
+  "cac0f562c69ab14a5a320e2f6529d1d2",
+  "13ed8618499072832a6f32c75010396f",
+  "274611a6d42329ccfae656b07c24e78a",
+  "b33d2548f288f3ef0ac1c411d11d65af",
+  "2d5bc22cb4f69649a203f5996d77fc84",
+  "d9b88527d8137dd75893dd39265e572a",
+  "72b34deda87c4df04f75caec9bb7e4a6",
+  "103e7870a17efc5e2ffe22537c67ce15",
+  "428244e1514537d671c69f3a8bb773f7",
+  "f5943a32e073525227e9ab993c74c550",
+  "85736f98654a03ef9430dec95353e015",
+  "71ac8eeb2209f0c8764d7b98d8462cfe",
+  "d1b24da1136c32ffe21d2ce10582f8fa",
+  "16f84cbf793252846815f449bac5957f",
+  "a2a5059bfd1c616f8d4799574eb4b6c3",
+  "ecf2142de85771c6ad6322855fb8c46c",
+  "81f5ca53bf783e99aa2f8846a0bfcfbc",
+  "3236d5df0b32983524f42d0aa14a88b8",
+  "1b6e30ceffaa55ed08b4d711fd90def7",
+  "4b663b2dbb5033aca09e2cf92c525a0e",
+  "d7558334280d2f1be22cf7357090f15f",
+  "11e7158ea2fec675e72aab1c333a7fcf",
+  "3f77c5415de3c8ef09c0c97580a77bd6",
+  "225f761142fd66c14914aa2db9d5e981",
+  "0dfd36fe58877c4c077f3c305cce26af"
+};
+
+const duplex_t start = {
+  { 0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c },
+  { 0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c },
+  { 0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c },
+};
+
+static int check(uint8_t *in, const char *hex) {
+  for (uint8_t byte = 0; *hex; in++, hex += 2)
+    if (sscanf(hex, "%02hhx", &byte) != 1 || byte != *in)
+      return -1;
+  return 0;
+}
+
+int main(void) {
+  const size_t max = sizeof(tags) / sizeof(*tags) - 1;
+  uint8_t in[max], out[max], tag[duplex_rate];
+  duplex_t state;
+
+  for (size_t i = 0; i < max; i++)
+    in[i] = (uint8_t) i;
+
+  for (size_t length = 0; length <= max; length++) {
+    memcpy(state, start, duplex_size);
+    duplex_keyed(state);
+    duplex_keyed_absorb(state, in, max - length);
+    duplex_keyed_pad(state);
+    duplex_keyed_ratchet(state);
+    memcpy(out, in, length);
+    duplex_keyed_encrypt(state, out, length);
+    duplex_keyed_pad(state);
+    duplex_keyed_squeeze(state, tag, duplex_rate);
+    if (check(tag, tags[length])) /* variable time */
+      errx(EXIT_FAILURE, "Keyed encryption failure with %zd-byte message "
+        "and %zd-byte associated data", length, max - length);
+
+    memcpy(state, start, duplex_size);
+    duplex_keyed(state);
+    duplex_keyed_absorb(state, in, max - length);
+    duplex_keyed_pad(state);
+    duplex_keyed_ratchet(state);
+    duplex_keyed_decrypt(state, out, length);
+    duplex_keyed_pad(state);
+    duplex_keyed_squeeze(state, tag, duplex_rate);
+    if (memcmp(in, out, length)) /* variable time */
+      errx(EXIT_FAILURE, "Keyed decryption failure with %zd-byte message "
+        "and %zd-byte associated data", length, max - length);
+    if (check(tag, tags[length])) /* variable time */
+      errx(EXIT_FAILURE, "Keyed authentication failure with %zd-byte "
+        "message and %zd-byte associated data", length, max - length);
+  }
+
+  printf("Reference keyed Xoodoo tags checked\n");
+  return EXIT_SUCCESS;
+}
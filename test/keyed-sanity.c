@@ -0,0 +1,144 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "keyed.h"
+
+static void chunk_encrypt(duplex_t state, uint8_t *buffer, size_t length,
+    size_t chunk) {
+  while (chunk <= length) {
+    duplex_keyed_encrypt(state, buffer, chunk);
+    buffer += chunk, length -= chunk;
+  }
+  duplex_keyed_encrypt(state, buffer, length);
+  duplex_keyed_pad(state);
+}
+
+static void byte_absorb(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    size_t offset = duplex_counter(state)++ % duplex_keyed_rate;
+    duplex_byte(state, offset) ^= buffer[i];
+    if (offset == duplex_keyed_rate - 1)
+      duplex_keyed_permute(state);
+  }
+}
+
+static void byte_decrypt(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    size_t offset = duplex_counter(state)++ % duplex_keyed_rate;
+    buffer[i] ^= duplex_byte(state, offset);
+    duplex_byte(state, offset) ^= buffer[i];
+    if (offset == duplex_keyed_rate - 1)
+      duplex_keyed_permute(state);
+  }
+}
+
+static void byte_encrypt(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    size_t offset = duplex_counter(state)++ % duplex_keyed_rate;
+    duplex_byte(state, offset) ^= buffer[i];
+    buffer[i] = duplex_byte(state, offset);
+    if (offset == duplex_keyed_rate - 1)
+      duplex_keyed_permute(state);
+  }
+}
+
+static void byte_squeeze(duplex_t state, uint8_t *buffer, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    size_t offset = duplex_counter(state)++ % duplex_keyed_rate;
+    buffer[i] = duplex_byte(state, offset);
+    if (offset == duplex_keyed_rate - 1)
+      duplex_keyed_permute(state);
+  }
+}
+
+static void fill(void *out1, void *out2, size_t length) {
+  static uint32_t seed = 0x12345678;
+  for (size_t i = 0; i < length; i++) {
+    seed += seed * seed | 5;
+    ((uint8_t *) out1)[i] = seed >> 24;
+    ((uint8_t *) out2)[i] = seed >> 24;
+  }
+}
+
+int main(void) {
+  const size_t min = 16, max = 96, size = 4096;
+  uint8_t buffer1[size], buffer2[size];
+  duplex_t state1, state2;
+
+  /* Check operations at every offset match byte-at-a-time ones */
+  for (size_t offset = 0; offset < duplex_keyed_rate; offset++)
+    for (size_t length = 0; length < 4 * duplex_keyed_rate; length++) {
+      void (*bulk[])(duplex_t, void *, size_t) = {
+        (void (*)(duplex_t, void *, size_t)) duplex_keyed_absorb,
+        duplex_keyed_decrypt, duplex_keyed_encrypt, duplex_keyed_squeeze
+      };
+      void (*bytes[])(duplex_t, uint8_t *, size_t) = {
+        byte_absorb, byte_decrypt, byte_encrypt, byte_squeeze
+      };
+
+      for (int i = 0; i < 4; i++) {
+        fill(buffer1, buffer2, length + 16);
+        fill(state1, state2, duplex_size);
+        duplex_counter(state1) = duplex_counter(state2) = offset;
+        bulk[i](state1, buffer1 + 8, length);
+        bytes[i](state2, buffer2 + 8, length);
+        if (memcmp(buffer1, buffer2, length + 16))
+          errx(EXIT_FAILURE, "Keyed operation failure");
+        if (memcmp(state1, state2, duplex_size))
+          errx(EXIT_FAILURE, "Keyed operation failure");
+      }
+    }
+
+  /* Check streaming encrypt + pad matches a padded bulk encrypt */
+  for (size_t length = size - duplex_keyed_rate; length <= size; length++)
+    for (size_t chunk = min; chunk <= max; chunk++) {
+      fill(buffer1, buffer2, length);
+      fill(state1, state2, duplex_size);
+      duplex_keyed_encrypt(state1, buffer1, length);
+      duplex_keyed_pad(state1);
+      chunk_encrypt(state2, buffer2, length, chunk);
+      if (memcmp(buffer1, buffer2, length))
+        errx(EXIT_FAILURE, "Streaming keyed encrypt failure");
+      if (memcmp(state1, state2, duplex_size))
+        errx(EXIT_FAILURE, "Streaming keyed encrypt failure");
+    }
+
+  /* Check decryption inverts encryption and leaves the same state */
+  for (size_t length = 0; length < 4 * duplex_keyed_rate; length++) {
+    uint8_t plain[length + 1];
+    fill(buffer1, plain, length);
+    fill(state1, state2, duplex_size);
+    duplex_keyed(state1), duplex_keyed(state2);
+    duplex_keyed_encrypt(state1, buffer1, length);
+    duplex_keyed_pad(state1);
+    duplex_keyed_decrypt(state2, buffer1, length);
+    duplex_keyed_pad(state2);
+    if (memcmp(buffer1, plain, length))
+      errx(EXIT_FAILURE, "Keyed decrypt failure");
+    if (memcmp(state1, state2, duplex_size))
+      errx(EXIT_FAILURE, "Keyed decrypt failure");
+  }
+
+  /* Check the ratchet clears a full rate and keeps the offset */
+  for (size_t offset = 0; offset < duplex_keyed_rate; offset++) {
+    fill(state1, state2, duplex_size);
+    duplex_counter(state1) = duplex_counter(state2) = offset;
+    duplex_keyed_ratchet(state1);
+    for (size_t i = offset; i < duplex_keyed_rate; i++)
+      duplex_byte(state2, i) = 0;
+    duplex_keyed_permute(state2);
+    for (size_t i = 0; i < offset; i++)
+      duplex_byte(state2, i) = 0;
+    duplex_counter(state2) += duplex_keyed_rate;
+    if (memcmp(state1, state2, duplex_size))
+      errx(EXIT_FAILURE, "Keyed ratchet failure");
+  }
+
+  printf("Keyed duplex operations sanity-checked\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "keyed.h"
+
+static duplex_t state = { 0 };
+static uint8_t buffer[65536];
+
+static double permute(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    duplex_permute(state);
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double speed(void (*operation)(void), size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    operation();
+  double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  return (double) repeat * sizeof(buffer) / seconds / (1 << 20);
+}
+
+static double partial(void (*operation)(size_t), size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    for (size_t offset = 0; offset < duplex_keyed_rate; offset++)
+      for (size_t length = 0; length < 64; length++) {
+        duplex_counter(state) = offset;
+        operation(length);
+      }
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat
+    / duplex_keyed_rate / 64;
+}
+
+static void absorb(void) {
+  duplex_keyed_absorb(state, buffer, sizeof(buffer));
+}
+
+static void squeeze(void) {
+  duplex_keyed_squeeze(state, buffer, sizeof(buffer));
+}
+
+static void encrypt(void) {
+  duplex_keyed_encrypt(state, buffer, sizeof(buffer));
+}
+
+static void decrypt(void) {
+  duplex_keyed_decrypt(state, buffer, sizeof(buffer));
+}
+
+static void absorb_partial(size_t length) {
+  duplex_keyed_absorb(state, buffer, length);
+}
+
+static void squeeze_partial(size_t length) {
+  duplex_keyed_squeeze(state, buffer, length);
+}
+
+static void encrypt_partial(size_t length) {
+  duplex_keyed_encrypt(state, buffer, length);
+}
+
+static void decrypt_partial(size_t length) {
+  duplex_keyed_decrypt(state, buffer, length);
+}
+
+int main(void) {
+  for (size_t i = 0; i < sizeof(buffer); i++)
+    buffer[i] = (uint8_t) i;
+
+  permute(1 << 20); /* warm up any dynamic CPU frequency scaling */
+  printf("Xoodoo %d-byte keyed duplex absorbs at %0.1f MB/s\n",
+    duplex_keyed_rate, speed(absorb, 512));
+  printf("Xoodoo %d-byte keyed duplex squeezes at %0.1f MB/s\n",
+    duplex_keyed_rate, speed(squeeze, 512));
+  printf("Xoodoo %d-byte keyed duplex encrypts at %0.1f MB/s\n",
+    duplex_keyed_rate, speed(encrypt, 512));
+  printf("Xoodoo %d-byte keyed duplex decrypts at %0.1f MB/s\n",
+    duplex_keyed_rate, speed(decrypt, 512));
+  printf("Xoodoo %d-byte keyed duplex absorbs 0-63 bytes in %0.1f ns\n",
+    duplex_keyed_rate, partial(absorb_partial, 2048));
+  printf("Xoodoo %d-byte keyed duplex squeezes 0-63 bytes in %0.1f ns\n",
+    duplex_keyed_rate, partial(squeeze_partial, 2048));
+  printf("Xoodoo %d-byte keyed duplex encrypts 0-63 bytes in %0.1f ns\n",
+    duplex_keyed_rate, partial(encrypt_partial, 2048));
+  printf("Xoodoo %d-byte keyed duplex decrypts 0-63 bytes in %0.1f ns\n\n",
+    duplex_keyed_rate, partial(decrypt_partial, 2048));
+
+  return EXIT_SUCCESS;
+}
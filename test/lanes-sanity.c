@@ -0,0 +1,158 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "lanes.h"
+
+static void fill(void *out1, void *out2, size_t length) {
+  static uint32_t seed = 0x12345678;
+  for (size_t i = 0; i < length; i++) {
+    seed += seed * seed | 5;
+    ((uint8_t *) out1)[i] = seed >> 24;
+    ((uint8_t *) out2)[i] = seed >> 24;
+  }
+}
+
+static void seal(duplex_t state, uint8_t *data, size_t length) {
+  duplex_encrypt(state, data, length);
+  duplex_pad(state);
+  duplex_squeeze(state, data + length, duplex_rate);
+}
+
+static int open(duplex_t state, uint8_t *data, size_t length) {
+  duplex_decrypt(state, data, length);
+  duplex_pad(state);
+  duplex_decrypt(state, data + length, duplex_rate);
+  return duplex_compare(data + length, 0, duplex_rate);
+}
+
+int main(void) {
+  const size_t max = 3 * duplex_lanes + 1, size = 80 + duplex_rate;
+  uint8_t buffers1[max][size], buffers2[max][size], *data[max];
+  size_t length[max];
+  int result[max];
+  duplex_t states1[max], states2[max];
+  uint32x4_t *state[max];
+
+  for (size_t i = 0; i < max; i++)
+    state[i] = states2[i], data[i] = buffers2[i];
+
+  /* Check multi-lane Gimli matches the single-state permutation */
+  for (size_t count = 0; count <= max; count++) {
+    fill(states1, states2, sizeof(states1));
+    for (size_t i = 0; i < count; i++)
+      duplex_gimli(states1[i]);
+    duplex_lanes_many(state, count, duplex_gimli_lanes);
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Multi-lane Gimli failure");
+  }
+
+  /* Check multi-lane Xoodoo matches the single-state permutation */
+  for (size_t count = 0; count <= max; count++) {
+    fill(states1, states2, sizeof(states1));
+    for (size_t i = 0; i < count; i++)
+      duplex_xoodoo(states1[i]);
+    duplex_permute_many(state, count);
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Multi-lane Xoodoo failure");
+  }
+
+  /* Check multi-lane 6-round Xoodoo matches the single-state permutation */
+  for (size_t count = 0; count <= max; count++) {
+    fill(states1, states2, sizeof(states1));
+    for (size_t i = 0; i < count; i++)
+      duplex_xoodoo6(states1[i]);
+    duplex_lanes_many(state, count, duplex_xoodoo6_lanes);
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Multi-lane 6-round Xoodoo failure");
+  }
+
+  /* Check batched duplex operations match single-state operations */
+  for (size_t count = 0; count <= max; count++) {
+    fill(states1, states2, sizeof(states1));
+    fill(buffers1, buffers2, sizeof(buffers1));
+    for (size_t i = 0; i < count; i++) {
+      length[i] = buffers1[i][0] % (size - duplex_rate + 1);
+      duplex_counter(states1[i]) = duplex_counter(states2[i]) = i;
+    }
+
+    for (size_t i = 0; i < count; i++)
+      duplex_absorb(states1[i], buffers1[i], length[i]);
+    duplex_absorb_many(state, (const uint8_t *const *) data,
+      length, count);
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Batched absorb failure");
+
+    for (size_t i = 0; i < count; i++)
+      duplex_decrypt(states1[i], buffers1[i], length[i]);
+    duplex_decrypt_many(state, data, length, count);
+    if (memcmp(buffers1, buffers2, sizeof(buffers1)))
+      errx(EXIT_FAILURE, "Batched decrypt failure");
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Batched decrypt failure");
+
+    for (size_t i = 0; i < count; i++)
+      duplex_encrypt(states1[i], buffers1[i], length[i]);
+    duplex_encrypt_many(state, data, length, count);
+    if (memcmp(buffers1, buffers2, sizeof(buffers1)))
+      errx(EXIT_FAILURE, "Batched encrypt failure");
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Batched encrypt failure");
+
+    for (size_t i = 0; i < count; i++)
+      duplex_pad(states1[i]);
+    duplex_pad_many(state, count);
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Batched pad failure");
+
+    for (size_t i = 0; i < count; i++)
+      duplex_squeeze(states1[i], buffers1[i], length[i]);
+    duplex_squeeze_many(state, data, length, count);
+    if (memcmp(buffers1, buffers2, sizeof(buffers1)))
+      errx(EXIT_FAILURE, "Batched squeeze failure");
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Batched squeeze failure");
+  }
+
+  /* Check batched authenticated encryption matches single-state */
+  for (size_t count = 0; count <= max; count++) {
+    fill(states1, states2, sizeof(states1));
+    fill(buffers1, buffers2, sizeof(buffers1));
+    for (size_t i = 0; i < count; i++) {
+      length[i] = buffers1[i][0] % (size - duplex_rate + 1);
+      duplex_counter(states1[i]) = duplex_counter(states2[i]) = 0;
+    }
+
+    duplex_t copies[max];
+    memcpy(copies, states1, sizeof(states1));
+    for (size_t i = 0; i < count; i++)
+      seal(states1[i], buffers1[i], length[i]);
+    duplex_seal_many(state, data, length, count);
+    if (memcmp(buffers1, buffers2, sizeof(buffers1)))
+      errx(EXIT_FAILURE, "Batched seal failure");
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Batched seal failure");
+
+    memcpy(states1, copies, sizeof(states1));
+    memcpy(states2, copies, sizeof(states2));
+    if (count > 0)
+      buffers2[count - 1][length[count - 1]] ^= 1;
+    for (size_t i = 0; i < count; i++)
+      if (open(states1[i], buffers1[i], length[i]))
+        errx(EXIT_FAILURE, "Valid single-state open failed");
+    if (duplex_open_many(state, data, length, result, count) != -(count > 0))
+      errx(EXIT_FAILURE, "Batched open failure");
+    for (size_t i = 0; i < count; i++)
+      if (result[i] != -(i + 1 == count))
+        errx(EXIT_FAILURE, "Batched open failure");
+    if (count && memcmp(buffers1, buffers2, (count - 1) * size))
+      errx(EXIT_FAILURE, "Batched open failure");
+  }
+
+  printf("Multi-lane duplex operations sanity-checked\n");
+  return EXIT_SUCCESS;
+}
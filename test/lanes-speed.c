@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "duplex.h"
+#include "lanes.h"
+
+enum { batch = 256 };
+
+static duplex_lane_t lanes[12];
+static duplex_t states[batch];
+static uint8_t buffers[batch][1500 + duplex_rate];
+
+static double gimli(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    duplex_gimli_lanes(lanes);
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat / duplex_lanes;
+}
+
+static double xoodoo(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    duplex_xoodoo_lanes(lanes);
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat / duplex_lanes;
+}
+
+static double xoodoo6(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    duplex_xoodoo6_lanes(lanes);
+  return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat / duplex_lanes;
+}
+
+static double single(size_t repeat, size_t size) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    for (size_t j = 0; j < batch; j++) {
+      duplex_encrypt(states[j], buffers[j], size);
+      duplex_pad(states[j]);
+      duplex_squeeze(states[j], buffers[j] + size, duplex_rate);
+    }
+  double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  return repeat * batch / seconds / 1.0e6;
+}
+
+static double many(size_t repeat, size_t size) {
+  uint32x4_t *state[batch];
+  uint8_t *data[batch];
+  size_t length[batch];
+
+  for (size_t j = 0; j < batch; j++)
+    state[j] = states[j], data[j] = buffers[j], length[j] = size;
+
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    duplex_seal_many(state, data, length, batch);
+  double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  return repeat * batch / seconds / 1.0e6;
+}
+
+int main(void) {
+  const size_t sizes[] = { 64, 256, 576, 1500 };
+
+  xoodoo(1 << 18); /* warm up any dynamic CPU frequency scaling */
+  printf("%d-lane Gimli permutes in %0.1f ns per state\n", duplex_lanes,
+    gimli(1 << 18));
+  printf("%d-lane Xoodoo permutes in %0.1f ns per state\n", duplex_lanes,
+    xoodoo(1 << 18));
+  printf("%d-lane 6-round Xoodoo permutes in %0.1f ns per state\n",
+    duplex_lanes, xoodoo6(1 << 18));
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++) {
+    size_t repeat = (1 << 15) / (sizes[i] + 32);
+    printf("Xoodoo seals %zd-byte messages at %0.2f M/s single, "
+      "%0.2f M/s batched\n", sizes[i], single(repeat, sizes[i]),
+      many(repeat, sizes[i]));
+  }
+  printf("\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "stream.h"
+
+static void fill(void *out1, void *out2, size_t length) {
+  static uint32_t seed = 0x12345678;
+  for (size_t i = 0; i < length; i++) {
+    seed += seed * seed | 5;
+    ((uint8_t *) out1)[i] = seed >> 24;
+    ((uint8_t *) out2)[i] = seed >> 24;
+  }
+}
+
+static void seal(duplex_t session, uint8_t *data, size_t length,
+    uint64_t index) {
+  duplex_t state;
+  duplex_stream_state(state, session, index);
+  duplex_encrypt(state, data, length);
+  duplex_pad(state);
+  duplex_squeeze(state, data + length, duplex_rate);
+}
+
+int main(void) {
+  const size_t max = 2 * duplex_lanes + 3, size = 200 + duplex_rate;
+  uint8_t buffers1[max][size], buffers2[max][size], *data[max];
+  size_t length[max];
+  duplex_t session;
+
+  for (size_t i = 0; i < max; i++)
+    data[i] = buffers2[i], length[i] = (37 * i) % 200;
+  fill(session, session, duplex_size);
+  duplex_stream(session);
+
+  /* Check batched chunk sealing matches chunk-at-a-time sealing */
+  for (size_t count = 0; count <= max; count++) {
+    fill(buffers1, buffers2, sizeof(buffers1));
+    for (size_t i = 0; i < count; i++)
+      seal(session, buffers1[i], length[i], 1000 + i);
+    duplex_stream_seal(session, data, length, 1000, count);
+    if (memcmp(buffers1, buffers2, sizeof(buffers1)))
+      errx(EXIT_FAILURE, "Stream seal failure");
+  }
+
+  /* Check sealed chunks open to their original plaintext */
+  fill(buffers1, buffers2, sizeof(buffers1));
+  duplex_stream_seal(session, data, length, 0, max);
+  if (duplex_stream_open(session, data, length, 0, max))
+    errx(EXIT_FAILURE, "Stream open failure");
+  for (size_t i = 0; i < max; i++)
+    if (memcmp(buffers1[i], buffers2[i], length[i]))
+      errx(EXIT_FAILURE, "Stream open failure");
+
+  /* Check chunks fail to open at the wrong index */
+  memcpy(buffers1, buffers2, sizeof(buffers1));
+  duplex_stream_seal(session, data, length, 0, max);
+  if (!duplex_stream_open(session, data + 1, length + 1, 0, max - 1))
+    errx(EXIT_FAILURE, "Stream reordering undetected");
+
+  /* Check a modified chunk length is detected */
+  memcpy(buffers2, buffers1, sizeof(buffers1));
+  duplex_stream_seal(session, data, length, 0, max);
+  length[max - 1] -= 1;
+  memmove(data[max - 1] + length[max - 1],
+    data[max - 1] + length[max - 1] + 1, duplex_rate);
+  if (!duplex_stream_open(session, data, length, 0, max))
+    errx(EXIT_FAILURE, "Stream truncation undetected");
+
+  /* Check stream sizes map back to chunk counts and plaintext lengths */
+  for (uint64_t chunks = 1; chunks < 4; chunks++)
+    for (uint64_t last = 0; last < duplex_stream_chunk; last += 4093) {
+      uint64_t length = (chunks - 1) * duplex_stream_chunk + last;
+      uint64_t size = length + chunks * duplex_rate;
+      if (duplex_stream_chunks(size) != chunks)
+        errx(EXIT_FAILURE, "Stream size failure");
+      if (duplex_stream_length(size) != length)
+        errx(EXIT_FAILURE, "Stream size failure");
+      if (duplex_stream_chunks(size - last - 1) != 0)
+        errx(EXIT_FAILURE, "Stream size failure");
+    }
+
+  printf("Chunked stream operations sanity-checked\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "duplex.h"
+#include "stream.h"
+
+enum { batch = 4 * duplex_lanes, chunk = duplex_stream_chunk };
+
+static duplex_t session = { 0 };
+static uint8_t buffers[batch][chunk + duplex_rate];
+
+static double speed(void (*operation)(void), size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    operation();
+  double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  return (double) repeat * batch * chunk / seconds / (1 << 20);
+}
+
+static void chained(void) {
+  for (size_t i = 0; i < batch; i++) {
+    duplex_encrypt(session, buffers[i], chunk);
+    duplex_pad(session);
+    duplex_squeeze(session, buffers[i] + chunk, duplex_rate);
+  }
+}
+
+static void chunked(void) {
+  uint8_t *data[batch];
+  size_t length[batch];
+
+  for (size_t i = 0; i < batch; i++)
+    data[i] = buffers[i], length[i] = chunk;
+  duplex_stream_seal(session, data, length, 0, batch);
+}
+
+int main(void) {
+  duplex_stream(session);
+  speed(chained, 4); /* warm up any dynamic CPU frequency scaling */
+  printf("Xoodoo chained stream encrypts at %0.1f MB/s\n",
+    speed(chained, 8));
+  printf("Xoodoo %d-lane chunked stream encrypts at %0.1f MB/s per core\n\n",
+    duplex_lanes, speed(chunked, 8));
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define duplex_chunk 256
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "tree.h"
+
+static void fill(void *out, size_t length) {
+  static uint32_t seed = 0x12345678;
+  for (size_t i = 0; i < length; i++) {
+    seed += seed * seed | 5;
+    ((uint8_t *) out)[i] = seed >> 24;
+  }
+}
+
+static void tree(duplex_t state, const uint8_t *data, size_t length) {
+  uint8_t digest[duplex_digest];
+  uint64_t index = 0;
+
+  duplex_node(state, duplex_root, duplex_chunk);
+  while (1) {
+    size_t chunk = length < duplex_chunk ? length : duplex_chunk;
+    duplex_t leaf = { 0 };
+
+    duplex_node(leaf, duplex_leaf, index++);
+    duplex_absorb(leaf, data, chunk);
+    duplex_pad(leaf);
+    duplex_squeeze(leaf, digest, duplex_digest);
+    duplex_absorb(state, digest, duplex_digest);
+
+    if (chunk < duplex_chunk)
+      break;
+    data += chunk, length -= chunk;
+  }
+  duplex_pad(state);
+}
+
+int main(void) {
+  const size_t leaves = 3 * duplex_lanes + 1;
+  const size_t size = leaves * duplex_chunk;
+  uint8_t data[size], digest1[leaves][duplex_digest];
+  uint8_t digest2[leaves][duplex_digest];
+  duplex_t state1, state2;
+
+  /* Check a batched tree hash matches leaf-at-a-time hashing */
+  for (size_t length = 0; length < size; length += 61) {
+    fill(data, length);
+    fill(state1, duplex_size);
+    memcpy(state2, state1, duplex_size);
+    duplex_tree(state1, data, length);
+    tree(state2, data, length);
+    if (memcmp(state1, state2, duplex_size))
+      errx(EXIT_FAILURE, "Tree hash failure");
+  }
+
+  /* Check exact multiples of the chunk size add an empty final leaf */
+  for (size_t length = 0; length < size; length += duplex_chunk) {
+    fill(data, length);
+    fill(state1, duplex_size);
+    memcpy(state2, state1, duplex_size);
+    duplex_tree(state1, data, length);
+    tree(state2, data, length);
+    if (memcmp(state1, state2, duplex_size))
+      errx(EXIT_FAILURE, "Tree hash failure");
+  }
+
+  /* Check leaves hashed in arbitrary groups match a single batch */
+  fill(data, size);
+  duplex_leaves(digest1, data, size, 0, leaves);
+  for (size_t group = 1; group <= leaves; group++) {
+    memset(digest2, 0, sizeof(digest2));
+    for (size_t i = 0; i < leaves; i += group) {
+      size_t count = leaves - i < group ? leaves - i : group;
+      duplex_leaves(digest2 + i, data + i * duplex_chunk,
+        size - i * duplex_chunk, i, count);
+    }
+    if (memcmp(digest1, digest2, sizeof(digest1)))
+      errx(EXIT_FAILURE, "Tree leaf failure");
+  }
+
+  /* Check tree and root nodes are separated from a sequential hash */
+  memset(state1, 0, duplex_size);
+  memset(state2, 0, duplex_size);
+  duplex_absorb(state1, data, size);
+  duplex_pad(state1);
+  duplex_tree(state2, data, size);
+  if (!memcmp(state1, state2, duplex_size))
+    errx(EXIT_FAILURE, "Tree domain separation failure");
+
+  printf("Tree hash operations sanity-checked\n");
+  return EXIT_SUCCESS;
+}
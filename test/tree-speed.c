@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "duplex.h"
+#include "tree.h"
+
+static duplex_t state = { 0 };
+static uint8_t buffer[64 * duplex_chunk];
+
+static double speed(void (*operation)(void), size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    operation();
+  double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  return (double) repeat * sizeof(buffer) / seconds / (1 << 20);
+}
+
+static void absorb(void) {
+  duplex_absorb(state, buffer, sizeof(buffer));
+  duplex_pad(state);
+}
+
+static void tree(void) {
+  duplex_tree(state, buffer, sizeof(buffer));
+}
+
+int main(void) {
+  for (size_t i = 0; i < sizeof(buffer); i++)
+    buffer[i] = (uint8_t) i;
+
+  speed(absorb, 8); /* warm up any dynamic CPU frequency scaling */
+  printf("Xoodoo duplex hashes at %0.1f MB/s\n", speed(absorb, 16));
+  printf("Xoodoo %d-lane tree hashes at %0.1f MB/s per core\n\n",
+    duplex_lanes, speed(tree, 16));
+  return EXIT_SUCCESS;
+}
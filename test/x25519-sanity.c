@@ -23,6 +23,8 @@ static void generate(x25519_t key) {
 }
 
 int main(void) {
+  static x25519_prepared_t prepared;
+
   for (size_t i = 0; i < 1000; i++) {
     x25519_t shared1, shared2, public1, public2, secret1, secret2;
 
@@ -56,9 +58,15 @@ int main(void) {
     if (x25519_verify(response, challenge, ephemeral, identity) != 0)
       errx(EXIT_FAILURE, "Valid signature failed to verify");
 
+    x25519_prepare(&prepared, identity);
+    if (x25519_verify_prepared(response, challenge, ephemeral, &prepared))
+      errx(EXIT_FAILURE, "Valid signature failed to verify");
+
     bitflip(challenge);
     if (x25519_verify(response, challenge, ephemeral, identity) == 0)
       errx(EXIT_FAILURE, "Invalid signature successfully verified");
+    if (!x25519_verify_prepared(response, challenge, ephemeral, &prepared))
+      errx(EXIT_FAILURE, "Invalid signature successfully verified");
   }
 
   for (size_t i = 0; i < 1000; i++) {
@@ -95,6 +103,193 @@ int main(void) {
       errx(EXIT_FAILURE, "Scalar representative is not equivalent");
   }
 
+  for (size_t i = 0; i < 1004; i++) {
+    const x25519_t order = {
+      0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+      0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+    x25519_t scalar, point1, point2;
+    int result1, result2;
+
+    generate(scalar);
+    if (i == 1000)
+      memset(scalar, 0, x25519_size);
+    if (i == 1001)
+      memset(scalar, 0xff, x25519_size);
+    if (i == 1002)
+      memcpy(scalar, order, x25519_size);
+    if (i == 1003)
+      memcpy(scalar, order, x25519_size), scalar[0]++;
+
+    result1 = x25519(point1, scalar, x25519_base);
+    result2 = x25519_public(point2, scalar);
+    if (result1 != result2 || memcmp(point1, point2, x25519_size) != 0)
+      errx(EXIT_FAILURE, "Fixed-base multiplication failed");
+  }
+
+  for (size_t i = 0; i < 1004; i++) {
+    x25519_t point, scalar, out1, out2, out3;
+    int result1, result2, result3;
+
+    /* Cover curve points with torsion, twist points and edge cases */
+    generate(point);
+    if (i % 2 == 0)
+      x25519_point(point, point);
+    if (i == 1000)
+      memset(point, 0, x25519_size);
+    if (i == 1001)
+      memset(point, 0xff, x25519_size), point[0] = 0xec, point[31] = 0x7f;
+    if (i == 1002)
+      memset(point, 0, x25519_size), point[0] = 1;
+    if (i == 1003)
+      memset(point, 0xff, x25519_size);
+    x25519_prepare(&prepared, point);
+
+    for (size_t j = 0; j < 8; j++) {
+      generate(scalar);
+      if (j == 0)
+        memset(scalar, 0, x25519_size);
+      if (j == 1)
+        memset(scalar, 0xff, x25519_size);
+
+      result1 = x25519(out1, scalar, point);
+      result2 = x25519_prepared(out2, scalar, &prepared);
+      result3 = x25519_prepared_vartime(out3, scalar, &prepared);
+      if (result1 != result2 || memcmp(out1, out2, x25519_size) != 0)
+        errx(EXIT_FAILURE, "Prepared multiplication failed");
+      if (result1 != result3 || memcmp(out1, out3, x25519_size) != 0)
+        errx(EXIT_FAILURE, "Prepared multiplication failed");
+    }
+  }
+
+  for (size_t count = 0; count <= 160; count += 32) {
+    x25519_t scalar[count + 1], point[count + 1], out[count + 1], single;
+    int result[count + 1], failed;
+
+    for (size_t i = 0; i <= count; i++) {
+      generate(scalar[i]);
+      generate(point[i]);
+      if (i % 5 == 0)
+        x25519(point[i], point[i], x25519_base);
+      if (i % 7 == 0)
+        memset(point[i], 0, x25519_size);
+    }
+
+    failed = x25519_batch(out, scalar, point, result, count + 1);
+    for (size_t i = 0; i <= count; i++) {
+      if (result[i] != x25519(single, scalar[i], point[i]))
+        errx(EXIT_FAILURE, "Batch multiplication failed");
+      if (memcmp(out[i], single, x25519_size) != 0)
+        errx(EXIT_FAILURE, "Batch multiplication failed");
+    }
+    if (failed != -1) /* point[0] is zero so always vanishes */
+      errx(EXIT_FAILURE, "Batch multiplication failed");
+  }
+
+  for (size_t count = 0; count <= 160; count += 32) {
+    x25519_t scalar[count + 1], out[count + 1], single;
+    int result[count + 1], failed;
+
+    for (size_t i = 0; i <= count; i++)
+      generate(scalar[i]);
+    memset(scalar[0], 0, x25519_size);
+
+    failed = x25519_public_batch(out, scalar, result, count + 1);
+    for (size_t i = 0; i <= count; i++) {
+      if (result[i] != x25519_public(single, scalar[i]))
+        errx(EXIT_FAILURE, "Batch key generation failed");
+      if (memcmp(out[i], single, x25519_size) != 0)
+        errx(EXIT_FAILURE, "Batch key generation failed");
+    }
+    if (failed != -1) /* scalar[0] is zero so always vanishes */
+      errx(EXIT_FAILURE, "Batch key generation failed");
+  }
+
+  for (size_t count = 0; count <= 160; count += 32) {
+    x25519_t scalar[count + 1], out[count + 1], single;
+
+    for (size_t i = 0; i <= count; i++) {
+      generate(scalar[i]);
+      if (i % 7 == 0)
+        memset(scalar[i], 0, x25519_size);
+      if (i % 11 == 1)
+        memset(scalar[i], 0xff, x25519_size);
+    }
+
+    x25519_invert_batch(out, scalar, count + 1);
+    for (size_t i = 0; i <= count; i++) {
+      x25519_invert(single, scalar[i]);
+      if (memcmp(out[i], single, x25519_size) != 0)
+        errx(EXIT_FAILURE, "Batch scalar inversion failed");
+    }
+  }
+
+  for (size_t count = 0; count <= 80; count += 16) {
+    x25519_t blind[count + 1], element[count + 1], key[count + 1];
+    x25519_t out[count + 1], single;
+    int result[count + 1], failed;
+
+    for (size_t i = 0; i <= count; i++) {
+      generate(blind[i]);
+      generate(element[i]);
+      generate(key[i]);
+      x25519_scalar(blind[i], blind[i]);
+    }
+    memset(blind[0], 0, x25519_size);
+
+    failed = x25519_blind_batch(out, blind, element, result, count + 1);
+    for (size_t i = 0; i <= count; i++) {
+      x25519_point(single, element[i]);
+      if (result[i] != x25519(single, blind[i], single))
+        errx(EXIT_FAILURE, "Batch blinding failed");
+      if (memcmp(out[i], single, x25519_size) != 0)
+        errx(EXIT_FAILURE, "Batch blinding failed");
+    }
+    if (failed != -1) /* blind[0] is zero so always vanishes */
+      errx(EXIT_FAILURE, "Batch blinding failed");
+
+    x25519_batch(out, key, out, 0, count + 1);
+    failed = x25519_unblind_batch(out, blind, out, result, count + 1);
+    for (size_t i = 0; i <= count; i++) {
+      x25519_point(single, element[i]);
+      x25519_scalar(key[i], key[i]);
+      if (result[i] != x25519(single, key[i], single) && i > 0)
+        errx(EXIT_FAILURE, "Batch unblinding failed");
+      if (memcmp(out[i], single, x25519_size) != 0 && i > 0)
+        errx(EXIT_FAILURE, "Batch unblinding failed");
+    }
+    if (failed != -1 || result[0] != -1)
+      errx(EXIT_FAILURE, "Batch unblinding failed");
+  }
+
+  for (size_t count = 0; count <= 80; count += 16) {
+    x25519_t challenge[count + 1], ephemeral[count + 1];
+    x25519_t identity[count + 1], response[count + 1];
+    int result[count + 1], failed;
+
+    for (size_t i = 0; i <= count; i++) {
+      generate(identity[i]);
+      generate(ephemeral[i]);
+      generate(challenge[i]);
+      x25519_sign(response[i], challenge[i], ephemeral[i], identity[i]);
+      x25519(ephemeral[i], ephemeral[i], x25519_base);
+      x25519(identity[i], identity[i], x25519_base);
+      if (i % 3 == 0)
+        bitflip(challenge[i]);
+    }
+
+    failed = x25519_verify_batch(response, challenge, ephemeral, identity,
+      result, count + 1);
+    for (size_t i = 0; i <= count; i++)
+      if (result[i] != x25519_verify(response[i], challenge[i],
+            ephemeral[i], identity[i]) || result[i] != -(i % 3 == 0))
+        errx(EXIT_FAILURE, "Batch verification failed");
+    if (failed != -1) /* challenge[0] is corrupted so always fails */
+      errx(EXIT_FAILURE, "Batch verification failed");
+  }
+
   printf("Key exchange and signatures sanity-checked\n");
   return EXIT_SUCCESS;
 }
@@ -1,10 +1,13 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "x25519.h"
 
 static uint8_t buffer[128];
+static x25519_prepared_t prepared;
+static x25519_t point;
 
 static double exchange(size_t repeat) {
   clock_t start = clock();
@@ -13,6 +16,58 @@ static double exchange(size_t repeat) {
   return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
 }
 
+static double batch(size_t repeat) {
+  x25519_t out[64], scalar[64], point[64];
+  for (size_t i = 0; i < 64; i++) {
+    memcpy(scalar[i], buffer + 32, x25519_size);
+    memcpy(point[i], buffer, x25519_size);
+  }
+
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i += 64)
+    x25519_batch(out, scalar, point, 0, 64);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double generate(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    x25519_public(buffer + 64, buffer + 32);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double generates(size_t repeat) {
+  x25519_t out[64], scalar[64];
+  for (size_t i = 0; i < 64; i++)
+    memcpy(scalar[i], buffer + 32, x25519_size);
+
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i += 64)
+    x25519_public_batch(out, scalar, 0, 64);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double prepare(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    x25519_prepare(&prepared, point);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double multiply(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    x25519_prepared(buffer + 64, buffer + 32, &prepared);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double vartime(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    x25519_prepared_vartime(buffer + 64, buffer + 32, &prepared);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
 static double invert(size_t repeat) {
   clock_t start = clock();
   for (size_t i = 0; i < repeat; i++)
@@ -20,6 +75,17 @@ static double invert(size_t repeat) {
   return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
 }
 
+static double inverts(size_t repeat) {
+  x25519_t out[64], scalar[64];
+  for (size_t i = 0; i < 64; i++)
+    memcpy(scalar[i], buffer, x25519_size);
+
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i += 64)
+    x25519_invert_batch(out, scalar, 64);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
 static double pointmap(size_t repeat) {
   clock_t start = clock();
   for (size_t i = 0; i < repeat; i++)
@@ -34,11 +100,39 @@ static double scalarmap(size_t repeat) {
   return 1.0e9 * (clock() - start) / CLOCKS_PER_SEC / repeat;
 }
 
+static double blind(size_t repeat) {
+  x25519_t scalar;
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++) {
+    x25519_point(buffer + 64, buffer);
+    x25519(buffer + 64, buffer + 32, buffer + 64);
+    x25519_invert(scalar, buffer + 32);
+    x25519_scalar(scalar, scalar);
+    x25519(buffer + 96, scalar, buffer + 64);
+  }
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double blinds(size_t repeat) {
+  x25519_t out[64], blind[64], element[64];
+  for (size_t i = 0; i < 64; i++) {
+    memcpy(blind[i], buffer + 32, x25519_size);
+    memcpy(element[i], buffer, x25519_size);
+  }
+
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i += 64) {
+    x25519_blind_batch(out, blind, element, 0, 64);
+    x25519_unblind_batch(out, blind, out, 0, 64);
+  }
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
 static double sign(size_t repeat) {
   clock_t start = clock();
   for (size_t i = 0; i < repeat; i++) {
     x25519_sign(buffer, buffer + 32, buffer + 64, buffer + 96);
-    x25519(buffer + 64, buffer + 64, x25519_base);
+    x25519_public(buffer + 64, buffer + 64);
   }
   return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
 }
@@ -50,17 +144,57 @@ static double verify(size_t repeat) {
   return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
 }
 
+static double verified(size_t repeat) {
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i++)
+    x25519_verify_prepared(buffer, buffer + 32, buffer + 64, &prepared);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
+static double verifies(size_t repeat) {
+  x25519_t response[64], challenge[64], ephemeral[64], identity[64];
+  for (size_t i = 0; i < 64; i++) {
+    memcpy(response[i], buffer, x25519_size);
+    memcpy(challenge[i], buffer + 32, x25519_size);
+    memcpy(ephemeral[i], buffer + 64, x25519_size);
+    memcpy(identity[i], buffer + 96, x25519_size);
+  }
+
+  clock_t start = clock();
+  for (size_t i = 0; i < repeat; i += 64)
+    x25519_verify_batch(response, challenge, ephemeral, identity, 0, 64);
+  return 1.0e6 * (clock() - start) / CLOCKS_PER_SEC / repeat;
+}
+
 int main(void) {
   for (size_t i = 0; i < sizeof(buffer); i++)
     buffer[i] = (uint8_t) i;
+  x25519_public(point, buffer);
 
   exchange(512); /* warm up any dynamic CPU frequency scaling */
   printf("X25519 exchanges in %0.1f us\n", exchange(1024));
+  printf("X25519 exchanges in batches in %0.1f us\n", batch(1024));
+  printf("X25519 generates public keys in %0.1f us\n", generate(4096));
+  printf("X25519 generates public keys in batches in %0.1f us\n",
+    generates(4096));
+  printf("X25519 prepares points in %0.1f us\n", prepare(1024));
+  printf("X25519 exchanges with prepared points in %0.1f us\n",
+    multiply(4096));
+  printf("X25519 multiplies public data by prepared points in %0.1f us\n",
+    vartime(4096));
   printf("X25519 inverts scalars in %0.1f us\n", invert(8192));
+  printf("X25519 inverts scalars in batches in %0.1f us\n",
+    inverts(8192));
   printf("X25519 maps to curve points in %0.1f us\n", pointmap(2<<12));
   printf("X25519 maps to safe scalars in %0.1f ns\n", scalarmap(2<<18));
+  printf("X25519 blinds and unblinds in %0.1f us\n", blind(1024));
+  printf("X25519 blinds and unblinds in batches in %0.1f us\n",
+    blinds(1024));
   printf("X25519 signs in %0.1f us\n", sign(1024));
-  printf("X25519 verifies in %0.1f us\n\n", verify(1024));
+  printf("X25519 verifies in %0.1f us\n", verify(1024));
+  printf("X25519 verifies in batches in %0.1f us\n", verifies(1024));
+  printf("X25519 verifies against prepared identities in %0.1f us\n\n",
+    verified(1024));
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,117 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "lanes.h"
+#include "tree.h"
+#include "xoodoo.h"
+
+static void fill(void *out1, void *out2, size_t length) {
+  static uint32_t seed = 0x12345678;
+  for (size_t i = 0; i < length; i++) {
+    seed += seed * seed | 5;
+    ((uint8_t *) out1)[i] = seed >> 24;
+    ((uint8_t *) out2)[i] = seed >> 24;
+  }
+}
+
+int main(void) {
+  const size_t max = 40, size = 300000;
+  uint8_t *buffer1 = malloc(size), *buffer2 = malloc(size);
+  duplex_t states1[max], states2[max];
+  uint32x4_t *state1[max], *state2[max];
+  uint8_t *data1[max], *data2[max];
+  size_t length[max];
+  int result1[max], result2[max];
+
+  if (buffer1 == NULL || buffer2 == NULL)
+    err(EXIT_FAILURE, "malloc");
+
+  /* Check library entry points match the inline duplex operations */
+  for (size_t length = 0; length < 200; length += 7) {
+    void (*inline_ops[])(duplex_t, void *, size_t) = {
+      (void (*)(duplex_t, void *, size_t)) duplex_absorb,
+      duplex_decrypt, duplex_encrypt, duplex_squeeze
+    };
+    void (*library_ops[])(duplex_t, void *, size_t) = {
+      (void (*)(duplex_t, void *, size_t)) xoodoo_absorb,
+      xoodoo_decrypt, xoodoo_encrypt, xoodoo_squeeze
+    };
+
+    for (int i = 0; i < 4; i++) {
+      fill(buffer1, buffer2, length);
+      fill(states1[0], states2[0], duplex_size);
+      duplex_counter(states1[0]) = duplex_counter(states2[0]) = length;
+      inline_ops[i](states1[0], buffer1, length);
+      duplex_pad(states1[0]);
+      duplex_ratchet(states1[0]);
+      library_ops[i](states2[0], buffer2, length);
+      xoodoo_pad(states2[0]);
+      xoodoo_ratchet(states2[0]);
+      if (memcmp(buffer1, buffer2, length))
+        errx(EXIT_FAILURE, "Library duplex operation failure");
+      if (memcmp(states1[0], states2[0], duplex_size))
+        errx(EXIT_FAILURE, "Library duplex operation failure");
+    }
+  }
+
+  /* Check library permutations match the inline permutations */
+  for (size_t count = 0; count <= max; count++) {
+    fill(states1, states2, sizeof(states1));
+    for (size_t i = 0; i < count; i++) {
+      duplex_xoodoo(states1[i]);
+      state2[i] = states2[i];
+    }
+    xoodoo_permute_many(state2, count);
+    xoodoo_permute(states1[0]);
+    duplex_xoodoo(states2[0]);
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Library permutation failure");
+  }
+
+  /* Check library batched sealing and opening match inline versions */
+  for (size_t count = 0; count <= max; count++) {
+    fill(states1, states2, sizeof(states1));
+    fill(buffer1, buffer2, max * 256);
+    for (size_t i = 0; i < count; i++) {
+      length[i] = buffer1[i * 256] % (256 - duplex_rate);
+      state1[i] = states1[i], data1[i] = buffer1 + i * 256;
+      state2[i] = states2[i], data2[i] = buffer2 + i * 256;
+    }
+
+    duplex_seal_many(state1, data1, length, count);
+    xoodoo_seal_many(state2, data2, length, count);
+    if (memcmp(buffer1, buffer2, max * 256))
+      errx(EXIT_FAILURE, "Library batched seal failure");
+    if (memcmp(states1, states2, sizeof(states1)))
+      errx(EXIT_FAILURE, "Library batched seal failure");
+
+    fill(states1, states2, sizeof(states1));
+    if (duplex_open_many(state1, data1, length, result1, count)
+        != xoodoo_open_many(state2, data2, length, result2, count))
+      errx(EXIT_FAILURE, "Library batched open failure");
+    if (memcmp(buffer1, buffer2, max * 256))
+      errx(EXIT_FAILURE, "Library batched open failure");
+    if (memcmp(result1, result2, count * sizeof(int)))
+      errx(EXIT_FAILURE, "Library batched open failure");
+  }
+
+  /* Check library tree hashing matches the inline tree hash */
+  for (size_t length = 0; length < size; length += 29999) {
+    fill(buffer1, buffer2, length);
+    fill(states1[0], states2[0], duplex_size);
+    duplex_tree(states1[0], buffer1, length);
+    xoodoo_tree(states2[0], buffer2, length);
+    if (memcmp(states1[0], states2[0], duplex_size))
+      errx(EXIT_FAILURE, "Library tree hash failure");
+  }
+
+  free(buffer1);
+  free(buffer2);
+  printf("Library duplex entry points sanity-checked\n");
+  return EXIT_SUCCESS;
+}
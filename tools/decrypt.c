@@ -2,8 +2,10 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include "duplex.h"
+#include "stream.h"
 #include "util.h"
 #include "x25519.h"
 
@@ -26,20 +28,33 @@ static void process(duplex_t state) {
   } while (length == chunk);
 }
 
+static int usage(const char *name) {
+  fprintf(stderr, "Usage: %s [-p] SK [PK]\n", name);
+  return 64;
+}
+
 int main(int argc, char **argv) {
   duplex_t state = { 0 };
   x25519_t point, scalar;
+  int option, stream = 0;
+
+  while ((option = getopt(argc, argv, "p")) > 0) {
+    if (option != 'p')
+      return usage(argv[0]);
+    stream = 1;
+  }
 
+  if (argc - optind != 1 && argc - optind != 2)
+    return usage(argv[0]);
+
+  argc -= optind - 1, argv += optind - 1;
   if (argc == 2) {
     load(argv[1], scalar, x25519_size);
     if (get(in, point, x25519_size) != x25519_size)
       errx(EXIT_FAILURE, "Input is truncated");
-  } else if (argc == 3) {
+  } else {
     load(argv[1], scalar, x25519_size);
     load(argv[2], point, x25519_size);
-  } else {
-    fprintf(stderr, "Usage: %s SK [PK]\n", argv[0]);
-    return 64;
   }
 
   if (x25519(point, scalar, point))
@@ -53,6 +68,9 @@ int main(int argc, char **argv) {
     duplex_absorb(state, nonce, duplex_rate);
   }
 
-  process(state);
+  if (stream)
+    crypt_stream(state, cores(), 1);
+  else
+    process(state);
   return EXIT_SUCCESS;
 }
@@ -2,8 +2,11 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include "duplex.h"
+#include "pool.h"
+#include "stream.h"
 #include "util.h"
 #include "x25519.h"
 
@@ -20,24 +23,48 @@ static void process(duplex_t state) {
   } while (length == chunk);
 }
 
+static int usage(const char *name) {
+  fprintf(stderr, "Usage: %s [-p] [SK] PK\n", name);
+  return 64;
+}
+
 int main(int argc, char **argv) {
   duplex_t state = { 0 };
-  x25519_t point, scalar;
+  x25519_t identity, point, scalar;
+  int option, stream = 0;
+
+  while ((option = getopt(argc, argv, "p")) > 0) {
+    if (option != 'p')
+      return usage(argv[0]);
+    stream = 1;
+  }
+
+  if (argc - optind != 1 && argc - optind != 2)
+    return usage(argv[0]);
 
+  argc -= optind - 1, argv += optind - 1;
   if (argc == 2) {
-    randomise(scalar, x25519_size);
-    x25519(point, scalar, x25519_base);
+    x25519_t ephemeral[1], secret[1];
+    struct pool pool;
+    pthread_t thread;
+
+    /* Precompute the ephemeral pair while the identity loads */
+    pool_init(&pool, secret, ephemeral, 1);
+    if ((errno = pthread_create(&thread, NULL, pool_fill, &pool)))
+      err(EXIT_FAILURE, "pthread_create");
+    load(argv[1], identity, x25519_size);
+    pthread_join(thread, NULL);
+
+    if (pool_take(&pool, scalar, point))
+      errx(EXIT_FAILURE, "Ephemeral pool is empty");
+    pool_wipe(&pool);
     put(out, point, x25519_size);
-    load(argv[1], point, x25519_size);
-  } else if (argc == 3) {
-    load(argv[1], scalar, x25519_size);
-    load(argv[2], point, x25519_size);
   } else {
-    fprintf(stderr, "Usage: %s [SK] PK\n", argv[0]);
-    return 64;
+    load(argv[1], scalar, x25519_size);
+    load(argv[2], identity, x25519_size);
   }
 
-  if (x25519(point, scalar, point))
+  if (x25519(point, scalar, identity))
     errx(EXIT_FAILURE, "Invalid public identity");
   duplex_absorb(state, point, x25519_size);
 
@@ -48,6 +75,9 @@ int main(int argc, char **argv) {
     duplex_absorb(state, nonce, duplex_rate);
   }
 
-  process(state);
+  if (stream)
+    crypt_stream(state, cores(), 0);
+  else
+    process(state);
   return EXIT_SUCCESS;
 }
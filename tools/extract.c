@@ -0,0 +1,112 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "duplex.h"
+#include "stream.h"
+#include "util.h"
+#include "x25519.h"
+
+static void extract(duplex_t session, off_t header, uint64_t index,
+    uint64_t count, uint64_t start, uint64_t end) {
+  size_t chunk = duplex_stream_chunk, record = duplex_stream_record;
+  uint8_t *buffer = malloc(duplex_lanes * record), *data[duplex_lanes];
+  size_t length[duplex_lanes];
+
+  if (!buffer)
+    err(EXIT_FAILURE, "malloc");
+  if (lseek(in, header + index * record, SEEK_SET) < 0)
+    err(EXIT_FAILURE, "lseek");
+
+  while (count > 0) {
+    size_t lanes = count < duplex_lanes ? count : duplex_lanes;
+    for (size_t i = 0; i < lanes; i++) {
+      data[i] = buffer + i * record;
+      length[i] = get(in, data[i], record);
+      if (length[i] < duplex_rate)
+        errx(EXIT_FAILURE, "Input is truncated");
+      length[i] -= duplex_rate;
+    }
+
+    if (duplex_stream_open(session, data, length, index, lanes))
+      errx(EXIT_FAILURE, "Authentication failed");
+
+    for (size_t i = 0; i < lanes; i++, index++, count--) {
+      uint64_t from = index * chunk, to = from + length[i];
+      from = from > start ? from : start, to = to < end ? to : end;
+      if (from < to)
+        put(out, data[i] + from - index * chunk, to - from);
+    }
+  }
+  free(buffer);
+}
+
+static void process(duplex_t session, off_t header, uint64_t start,
+    uint64_t end) {
+  uint64_t chunk = duplex_stream_chunk, chunks, first, limit, length;
+  struct stat status;
+
+  if (fstat(in, &status) < 0 || !S_ISREG(status.st_mode))
+    errx(EXIT_FAILURE, "Input is not seekable");
+  if (status.st_size < header)
+    errx(EXIT_FAILURE, "Input is truncated");
+  if (!(chunks = duplex_stream_chunks(status.st_size - header)))
+    errx(EXIT_FAILURE, "Input is truncated");
+
+  length = duplex_stream_length(status.st_size - header);
+  end = end < length ? end : length;
+  start = start < end ? start : end;
+  first = start / chunk, limit = end > start ? (end - 1) / chunk + 1 : first;
+
+  /* Authenticate the final chunk to confirm the total length */
+  if (limit < chunks)
+    extract(session, header, chunks - 1, 1, 0, 0);
+  extract(session, header, first, limit - first, start, end);
+}
+
+int main(int argc, char **argv) {
+  duplex_t state = { 0 };
+  x25519_t point, scalar;
+  uint64_t start, end;
+  uint8_t version;
+  off_t header;
+
+  if ((argc != 4 && argc != 5) || decimal(argv[1], &start)
+      || decimal(argv[2], &end)) {
+    fprintf(stderr, "Usage: %s START END SK [PK]\n", argv[0]);
+    return 64;
+  }
+
+  load(argv[3], scalar, x25519_size);
+
+  if (argc == 4) {
+    if (get(in, point, x25519_size) != x25519_size)
+      errx(EXIT_FAILURE, "Input is truncated");
+  } else {
+    load(argv[4], point, x25519_size);
+  }
+
+  if (x25519(point, scalar, point))
+    errx(EXIT_FAILURE, "Invalid public identity");
+  duplex_absorb(state, point, x25519_size);
+
+  if (argc == 5) {
+    uint8_t nonce[duplex_rate];
+    if (get(in, nonce, duplex_rate) != duplex_rate)
+      errx(EXIT_FAILURE, "Input is truncated");
+    duplex_absorb(state, nonce, duplex_rate);
+  }
+
+  if (get(in, &version, 1) != 1)
+    errx(EXIT_FAILURE, "Input is truncated");
+  if (version != duplex_stream_version)
+    errx(EXIT_FAILURE, "Unsupported stream version");
+  duplex_stream(state);
+
+  header = argc == 4 ? x25519_size + 1 : duplex_rate + 1;
+  process(state, header, start, end);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,33 @@
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "duplex.h"
+#include "tree.h"
+#include "util.h"
+
+static int usage(const char *name) {
+  fprintf(stderr, "Usage: %s [-j THREADS]\n", name);
+  return 64;
+}
+
+int main(int argc, char **argv) {
+  duplex_t state = { 0 };
+  uint8_t digest[duplex_digest];
+  size_t threads = cores();
+  int option;
+
+  while ((option = getopt(argc, argv, "j:")) > 0)
+    if (option != 'j' || (threads = number(optarg, 256)) == 0)
+      return usage(argv[0]);
+
+  if (optind != argc)
+    return usage(argv[0]);
+
+  absorb_tree(state, threads);
+  duplex_squeeze(state, digest, duplex_digest);
+  put(out, digest, duplex_digest);
+  return EXIT_SUCCESS;
+}
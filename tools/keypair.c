@@ -2,25 +2,133 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
 
+#include "duplex.h"
 #include "util.h"
 #include "x25519.h"
 
+struct job {
+  x25519_t *point, *scalar;
+  size_t count;
+};
+
+static void clamp(x25519_t scalar) {
+  scalar[0] &= 0xf8;
+  scalar[x25519_size - 1] &= 0x7f;
+  scalar[x25519_size - 1] |= 0x40;
+}
+
+static double elapsed(const struct timespec *start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec - start->tv_sec + 1.0e-9 * (now.tv_nsec
+    - start->tv_nsec);
+}
+
+static void *generate(void *context) {
+  struct job *job = context;
+  x25519_public_batch(job->point, job->scalar, NULL, job->count);
+  return NULL;
+}
+
+static void process(const char *dir, size_t total, size_t threads) {
+  size_t chunk = 256, batch = threads * chunk, count, used;
+  x25519_t *point = calloc(batch, x25519_size);
+  x25519_t *scalar = calloc(batch, x25519_size);
+  uint8_t *record = malloc(batch * 2 * x25519_size);
+  uint8_t seed[x25519_size];
+  duplex_t state = { 0 };
+  struct job job[threads];
+  struct timespec start;
+
+  if (!point || !scalar || !record)
+    err(EXIT_FAILURE, "malloc");
+
+  /* One getentropy() seed drives a duplex squeezing every scalar */
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  randomise(seed, x25519_size);
+  duplex_absorb(state, seed, x25519_size);
+  duplex_pad(state);
+  duplex_zero(seed, x25519_size);
+
+  for (size_t index = 0; index < total; index += count) {
+    count = total - index < batch ? total - index : batch;
+    duplex_squeeze(state, scalar, count * x25519_size);
+    for (size_t i = 0; i < count; i++)
+      clamp(scalar[i]);
+
+    for (used = 0; used * chunk < count; used++) {
+      size_t first = used * chunk;
+      job[used].point = point + first, job[used].scalar = scalar + first;
+      job[used].count = count - first < chunk ? count - first : chunk;
+    }
+    parallel(generate, job, sizeof(*job), used);
+
+    if (dir) {
+      for (size_t i = 0; i < count; i++) {
+        char path[strlen(dir) + 32];
+        snprintf(path, sizeof(path), "%s/%zu.sk", dir, index + i);
+        save(path, scalar[i], x25519_size);
+        snprintf(path, sizeof(path), "%s/%zu.pk", dir, index + i);
+        save(path, point[i], x25519_size);
+      }
+    } else {
+      for (size_t i = 0; i < count; i++) {
+        memcpy(record + 2 * i * x25519_size, scalar[i], x25519_size);
+        memcpy(record + (2 * i + 1) * x25519_size, point[i], x25519_size);
+      }
+      put(out, record, 2 * count * x25519_size);
+    }
+  }
+
+  double seconds = elapsed(&start);
+  fprintf(stderr, "%zu keypairs in %.2f s, %.0f keys/s\n", total, seconds,
+    total / seconds);
+
+  duplex_zero(state, duplex_size);
+  duplex_zero(scalar, batch * x25519_size);
+  duplex_zero(record, batch * 2 * x25519_size);
+  free(point);
+  free(record);
+  free(scalar);
+}
+
+static int usage(const char *name) {
+  fprintf(stderr, "Usage: %s SK PK\n", name);
+  fprintf(stderr, "       %s -n COUNT [-j THREADS] [DIR]\n", name);
+  return 64;
+}
+
 int main(int argc, char **argv) {
   x25519_t point, scalar;
+  size_t count = 0, threads = cores();
+  int option, bulk = 0;
+
+  while ((option = getopt(argc, argv, "j:n:")) > 0) {
+    if (option == 'j' && (threads = number(optarg, 256)))
+      continue;
+    if (option == 'n' && (count = number(optarg, SIZE_MAX)))
+      bulk = 1;
+    else
+      return usage(argv[0]);
+  }
+
+  if (bulk ? argc - optind > 1 : argc - optind != 2)
+    return usage(argv[0]);
 
-  if (argc != 3) {
-    fprintf(stderr, "Usage: %s SK PK\n", argv[0]);
-    return 64;
+  if (bulk) {
+    process(optind < argc ? argv[optind] : NULL, count, threads);
+    return EXIT_SUCCESS;
   }
 
   randomise(scalar, x25519_size);
-  scalar[0] &= 0xf8;
-  scalar[x25519_size - 1] &= 0x7f;
-  scalar[x25519_size - 1] |= 0x40;
-  x25519(point, scalar, x25519_base);
+  clamp(scalar);
+  x25519_public(point, scalar);
 
-  save(argv[1], scalar, x25519_size);
-  save(argv[2], point, x25519_size);
+  save(argv[optind], scalar, x25519_size);
+  save(argv[optind + 1], point, x25519_size);
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,91 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <err.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "duplex.h"
+#include "x25519.h"
+
+/* A pool of precomputed (scalar, point) pairs in caller-supplied arrays.
+   pool_fill() tops it up and can run as a background thread; each pair
+   taken with pool_take() is wiped from the pool so it is never reused. */
+
+struct pool {
+  pthread_mutex_t lock;
+  x25519_t *scalar, *point;
+  size_t count, size;
+};
+
+static inline void pool_init(struct pool *pool, x25519_t scalar[],
+    x25519_t point[], size_t size) {
+  if ((errno = pthread_mutex_init(&pool->lock, NULL)))
+    err(EXIT_FAILURE, "pthread_mutex_init");
+  pool->scalar = scalar, pool->point = point;
+  pool->count = 0, pool->size = size;
+}
+
+static inline void *pool_fill(void *context) {
+  int getentropy(void *data, size_t length);
+  struct pool *pool = context;
+  x25519_t scalar[64], point[64];
+  size_t count;
+
+  while (1) {
+    pthread_mutex_lock(&pool->lock);
+    count = pool->size - pool->count;
+    pthread_mutex_unlock(&pool->lock);
+    if (count == 0)
+      break;
+
+    /* Generate outside the lock so takers are never held up */
+    count = count < 64 ? count : 64;
+    for (size_t i = 0; i < count; i += 8)
+      if (getentropy(scalar + i, 8 * x25519_size))
+        err(EXIT_FAILURE, "getentropy");
+    x25519_public_batch(point, scalar, NULL, count);
+
+    pthread_mutex_lock(&pool->lock);
+    if (count > pool->size - pool->count)
+      count = pool->size - pool->count;
+    memcpy(pool->scalar + pool->count, scalar, count * x25519_size);
+    memcpy(pool->point + pool->count, point, count * x25519_size);
+    pool->count += count;
+    pthread_mutex_unlock(&pool->lock);
+  }
+
+  duplex_zero(scalar, sizeof(scalar));
+  return NULL;
+}
+
+static inline int pool_take(struct pool *pool, x25519_t scalar,
+    x25519_t point) {
+  int result = -1;
+
+  pthread_mutex_lock(&pool->lock);
+  if (pool->count > 0) {
+    size_t last = --pool->count;
+    memcpy(scalar, pool->scalar[last], x25519_size);
+    memcpy(point, pool->point[last], x25519_size);
+    duplex_zero(pool->scalar[last], x25519_size);
+    duplex_zero(pool->point[last], x25519_size);
+    result = 0;
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return result;
+}
+
+static inline void pool_wipe(struct pool *pool) {
+  pthread_mutex_lock(&pool->lock);
+  duplex_zero(pool->scalar, pool->size * x25519_size);
+  duplex_zero(pool->point, pool->size * x25519_size);
+  pool->count = 0;
+  pthread_mutex_unlock(&pool->lock);
+  pthread_mutex_destroy(&pool->lock);
+}
+
+#endif
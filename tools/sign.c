@@ -3,8 +3,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "duplex.h"
+#include "tree.h"
 #include "util.h"
 #include "x25519.h"
 
@@ -17,28 +19,42 @@ static void process(duplex_t state) {
   duplex_pad(state);
 }
 
+static int usage(const char *name) {
+  fprintf(stderr, "Usage: %s [-t] SK [PK]\n", name);
+  return 64;
+}
+
 int main(int argc, char **argv) {
   duplex_t seed, state = { 0 };
+  int option, tree = 0;
   x25519_t challenge, identity, point, scalar, response, secret;
 
-  if (argc != 2 && argc != 3) {
-    fprintf(stderr, "Usage: %s SK [PK]\n", argv[0]);
-    return 64;
+  while ((option = getopt(argc, argv, "t")) > 0) {
+    if (option != 't')
+      return usage(argv[0]);
+    tree = 1;
   }
 
+  if (argc - optind != 1 && argc - optind != 2)
+    return usage(argv[0]);
+
+  argv += optind - 1;
   load(argv[1], secret, x25519_size);
   if (argv[2])
     load(argv[2], identity, x25519_size);
   else
-    x25519(identity, secret, x25519_base);
+    x25519_public(identity, secret);
 
-  process(state);
+  if (tree)
+    absorb_tree(state, cores());
+  else
+    process(state);
   duplex_absorb(state, identity, x25519_size);
 
   memcpy(seed, state, x25519_size);
   duplex_absorb(seed, secret, x25519_size);
   duplex_squeeze(seed, scalar, x25519_size);
-  x25519(point, scalar, x25519_base);
+  x25519_public(point, scalar);
 
   duplex_absorb(state, point, x25519_size);
   duplex_squeeze(state, challenge, x25519_size);
@@ -4,12 +4,27 @@
 #include <err.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 static const int in = STDIN_FILENO, out = STDOUT_FILENO;
 
+static inline size_t cores(void) {
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? count : 1;
+}
+
+static inline int decimal(const char *arg, uint64_t *value) {
+  char *end;
+
+  if (*arg < '0' || *arg > '9')
+    return -1;
+  errno = 0, *value = strtoull(arg, &end, 10);
+  return errno || *end ? -1 : 0;
+}
+
 static inline size_t get(int fd, uint8_t *data, size_t length) {
   ssize_t count, total = 0;
   while (length && (count = read(fd, data, length))) {
@@ -31,6 +46,23 @@ static inline void load(const char *file, void *data, size_t length) {
     close(fd);
 }
 
+static inline size_t number(const char *arg, size_t limit) {
+  uint64_t value;
+  return decimal(arg, &value) || value > limit ? 0 : value;
+}
+
+static inline void parallel(void *(*task)(void *), void *context,
+    size_t size, size_t count) {
+  pthread_t thread[count];
+  for (size_t i = 1; i < count; i++)
+    if ((errno = pthread_create(thread + i, 0, task,
+        (uint8_t *) context + i * size)))
+      err(EXIT_FAILURE, "pthread_create");
+  task(context);
+  for (size_t i = 1; i < count; i++)
+    pthread_join(thread[i], 0);
+}
+
 static inline void put(int fd, const uint8_t *data, size_t length) {
   while (length > 0) {
     ssize_t count = write(fd, data, length);
@@ -57,4 +89,136 @@ static inline void save(const char *file, const void *data,
     close(fd);
 }
 
+#ifdef STREAM_H
+struct stream_job {
+  const uint32x4_t *session;
+  uint8_t **data;
+  size_t *length, count;
+  uint64_t index;
+  int decrypt, result;
+};
+
+static inline void *stream_chunks(void *context) {
+  struct stream_job *job = context;
+  if (job->decrypt)
+    job->result = duplex_stream_open(job->session, job->data, job->length,
+      job->index, job->count);
+  else
+    duplex_stream_seal(job->session, job->data, job->length, job->index,
+      job->count);
+  return NULL;
+}
+
+static inline void crypt_stream(duplex_t session, size_t threads,
+    int decrypt) {
+  size_t batch = threads * duplex_lanes, count, size, used;
+  size_t chunk = duplex_stream_chunk, *length = calloc(batch, sizeof(size_t));
+  size_t tag = decrypt ? duplex_rate : 0;
+  uint8_t **data = calloc(batch, sizeof(uint8_t *));
+  uint8_t *buffer = malloc(batch * (chunk + duplex_rate));
+  uint8_t version = duplex_stream_version;
+  struct stream_job job[threads];
+  uint64_t index = 0;
+
+  if (!buffer || !data || !length)
+    err(EXIT_FAILURE, "malloc");
+  for (size_t i = 0; i < batch; i++)
+    data[i] = buffer + i * (chunk + duplex_rate);
+
+  if (!decrypt)
+    put(out, &version, 1);
+  else if (get(in, &version, 1) != 1)
+    errx(EXIT_FAILURE, "Input is truncated");
+  if (version != duplex_stream_version)
+    errx(EXIT_FAILURE, "Unsupported stream version");
+  duplex_stream(session);
+
+  do {
+    for (count = 0, size = 0; count < batch; count++) {
+      length[count] = get(in, data[count], chunk + tag);
+      if (length[count] < tag)
+        errx(EXIT_FAILURE, "Input is truncated");
+      length[count] -= tag;
+      size += length[count] + duplex_rate;
+      if (length[count] < chunk) {
+        count++;
+        break;
+      }
+    }
+
+    for (used = 0; used * duplex_lanes < count; used++) {
+      size_t first = used * duplex_lanes;
+      job[used].session = session, job[used].decrypt = decrypt;
+      job[used].data = data + first, job[used].length = length + first;
+      job[used].count = count - first < duplex_lanes ? count - first
+        : duplex_lanes;
+      job[used].index = index + first;
+    }
+
+    parallel(stream_chunks, job, sizeof(*job), used);
+    if (decrypt) {
+      for (size_t i = 0; i < used; i++)
+        if (job[i].result)
+          errx(EXIT_FAILURE, "Authentication failed");
+      for (size_t i = 0; i < count; i++)
+        put(out, data[i], length[i]);
+    } else {
+      put(out, buffer, size);
+    }
+    index += count;
+  } while (length[count - 1] == chunk);
+
+  free(buffer);
+  free(data);
+  free(length);
+}
+#endif
+
+#ifdef TREE_H
+struct tree_job {
+  uint8_t (*digest)[duplex_digest], *data;
+  size_t length, count;
+  uint64_t index;
+};
+
+static inline void *tree_leaves(void *context) {
+  struct tree_job *job = context;
+  duplex_leaves(job->digest, job->data, job->length, job->index, job->count);
+  return NULL;
+}
+
+static inline void absorb_tree(duplex_t state, size_t threads) {
+  size_t batch = threads * duplex_lanes, length;
+  uint8_t (*digest)[duplex_digest] = calloc(batch, duplex_digest);
+  uint8_t *data = malloc(batch * duplex_chunk);
+  struct tree_job job[threads];
+  uint64_t index = 0;
+
+  if (!data || !digest)
+    err(EXIT_FAILURE, "malloc");
+
+  duplex_node(state, duplex_root, duplex_chunk);
+  do {
+    length = get(in, data, batch * duplex_chunk);
+    size_t count = length / duplex_chunk + (length < batch * duplex_chunk);
+    size_t used = 0;
+
+    for (size_t i = 0; i < count; i += duplex_lanes, used++) {
+      job[used].digest = digest + i, job[used].index = index + i;
+      job[used].data = data + i * duplex_chunk;
+      job[used].length = length - i * duplex_chunk;
+      job[used].count = count - i < duplex_lanes ? count - i : duplex_lanes;
+    }
+
+    parallel(tree_leaves, job, sizeof(*job), used);
+    duplex_absorb(state, digest, count * duplex_digest);
+    index += count;
+  } while (length == batch * duplex_chunk);
+  duplex_pad(state);
+
+  free(data);
+  free(digest);
+}
+#endif
+
 #endif
@@ -2,8 +2,10 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include "duplex.h"
+#include "tree.h"
 #include "util.h"
 #include "x25519.h"
 
@@ -16,18 +18,32 @@ static void process(duplex_t state) {
   duplex_pad(state);
 }
 
+static int usage(const char *name) {
+  fprintf(stderr, "Usage: %s [-t] PK [SIG]\n", name);
+  return 64;
+}
+
 int main(int argc, char **argv) {
   duplex_t state = { 0 };
+  int option, tree = 0;
   x25519_t challenge, identity, signature[2];
 
-  if (argc != 2 && argc != 3) {
-    fprintf(stderr, "Usage: %s PK [SIG]\n", argv[0]);
-    return 64;
+  while ((option = getopt(argc, argv, "t")) > 0) {
+    if (option != 't')
+      return usage(argv[0]);
+    tree = 1;
   }
 
+  if (argc - optind != 1 && argc - optind != 2)
+    return usage(argv[0]);
+
+  argv += optind - 1;
   load(argv[1], identity, x25519_size);
   load(argv[2], signature, 2 * x25519_size);
-  process(state);
+  if (tree)
+    absorb_tree(state, cores());
+  else
+    process(state);
 
   duplex_absorb(state, identity, x25519_size);
   duplex_absorb(state, signature[0], x25519_size);
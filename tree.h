@@ -0,0 +1,74 @@
+/* tree.h from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
+
+#ifndef TREE_H
+#define TREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duplex.h"
+#include "lanes.h"
+
+#ifndef duplex_chunk
+#define duplex_chunk 65536
+#endif
+
+enum {
+  duplex_digest = 32,
+  duplex_leaf = 1,
+  duplex_root = 2
+};
+
+static inline void duplex_node(duplex_t state, uint8_t kind,
+    uint64_t value) {
+  state[0] ^= (uint32x4_t) { value, value >> 32, 0, 0 };
+  duplex_byte(state, 46) ^= kind;
+  duplex_counter(state) += 16;
+  duplex_permute(state);
+}
+
+static inline void duplex_leaves(uint8_t digest[][duplex_digest],
+    const uint8_t *data, size_t length, uint64_t index, size_t count) {
+  duplex_t leaf[duplex_lanes];
+  uint32x4_t *state[duplex_lanes];
+  const uint8_t *bytes[duplex_lanes];
+  uint8_t *hash[duplex_lanes];
+  size_t size[duplex_lanes], width[duplex_lanes];
+
+  for (size_t i = 0; i < count; i += duplex_lanes) {
+    size_t lanes = count - i < duplex_lanes ? count - i : duplex_lanes;
+
+    for (size_t j = 0; j < lanes; j++) {
+      size_t start = (i + j) * duplex_chunk;
+      state[j] = leaf[j], hash[j] = digest[i + j];
+      bytes[j] = data + (start < length ? start : length);
+      size[j] = start < length ? length - start : 0;
+      size[j] = size[j] < duplex_chunk ? size[j] : duplex_chunk;
+      width[j] = duplex_digest;
+
+      __builtin_memset(leaf[j], 0, duplex_size);
+      duplex_node(leaf[j], duplex_leaf, index + i + j);
+    }
+
+    duplex_absorb_many(state, bytes, size, lanes);
+    duplex_pad_many(state, lanes);
+    duplex_squeeze_many(state, hash, width, lanes);
+  }
+}
+
+static inline void duplex_tree(duplex_t state, const void *data,
+    size_t length) {
+  uint8_t digest[duplex_lanes][duplex_digest];
+  size_t count = length / duplex_chunk + 1;
+
+  duplex_node(state, duplex_root, duplex_chunk);
+  for (size_t i = 0; i < count; i += duplex_lanes) {
+    size_t lanes = count - i < duplex_lanes ? count - i : duplex_lanes;
+    size_t start = i * duplex_chunk;
+    duplex_leaves(digest, (const uint8_t *) data + start, length - start,
+      i, lanes);
+    duplex_absorb(state, digest, lanes * duplex_digest);
+  }
+  duplex_pad(state);
+}
+
+#endif
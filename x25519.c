@@ -1,6 +1,7 @@
 /* x25519.c from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
 /* Adapted from Mike Hamburg's STROBE: https://strobe.sourceforge.io/ */
 
+#include <stddef.h>
 #include <stdint.h>
 #define memcpy __builtin_memcpy
 #define memset __builtin_memset
@@ -13,6 +14,7 @@ const x25519_t x25519_base = { 9 };
 #define limb(x) x##ull
 enum { limbs = 4, width = 64 };
 typedef uint64_t limb_t;
+typedef int64_t slimb_t;
 typedef __uint128_t dlimb_t;
 typedef __int128_t sdlimb_t;
 
@@ -21,15 +23,86 @@ typedef __int128_t sdlimb_t;
 #define limb(x) (uint32_t) (x##ull), (uint32_t) ((x##ull) >> 32)
 enum { limbs = 8, width = 32 };
 typedef uint32_t limb_t;
+typedef int32_t slimb_t;
 typedef uint64_t dlimb_t;
 typedef int64_t sdlimb_t;
 
 #endif /* __SIZEOF_INT128__ */
 
-typedef limb_t element_t[limbs];
+#if !defined X25519_RADIX && !defined __SIZEOF_INT128__
+#define X25519_RADIX 25
+#endif
+
+#if X25519_RADIX == 51
+
+#ifndef __SIZEOF_INT128__
+#error Radix 2^51 field arithmetic needs 128-bit integer support
+#endif
+
+#define element(a, b, c, d) \
+  a##ull & radix_mask, (a##ull >> 51 | b##ull << 13) & radix_mask, \
+  (b##ull >> 38 | c##ull << 26) & radix_mask, \
+  (c##ull >> 25 | d##ull << 39) & radix_mask, d##ull >> 12
+#define radix_mask (((limb_t) 1 << 51) - 1)
+enum { terms = 5 };
+
+#elif X25519_RADIX == 25
+
+#define element(a, b, c, d) \
+  a##ull & radix_mask(0), a##ull >> 26 & radix_mask(1), \
+  (a##ull >> 51 | b##ull << 13) & radix_mask(0), \
+  b##ull >> 13 & radix_mask(1), b##ull >> 38 & radix_mask(0), \
+  c##ull & radix_mask(1), c##ull >> 25 & radix_mask(0), \
+  (c##ull >> 51 | d##ull << 13) & radix_mask(1), \
+  d##ull >> 12 & radix_mask(0), d##ull >> 38
+#define radix_bits(i) (26 - ((i) & 1))
+#define radix_mask(i) (((limb_t) 1 << radix_bits(i)) - 1)
+enum { terms = 10 };
+
+#else /* X25519_RADIX */
+
+#define element(a, b, c, d) limb(a), limb(b), limb(c), limb(d)
+enum { terms = limbs };
+
+#endif /* X25519_RADIX */
+
+typedef limb_t element_t[terms];
 typedef limb_t scalar_t[limbs];
 
-static const limb_t zero[limbs] = { 0 }, one[limbs] = { 1 };
+#if defined __x86_64__ && !defined X25519_PORTABLE
+#include <immintrin.h>
+#define LADDERS 8
+#define vector __attribute__((target("avx512f")))
+#define vmulu(x, y) (ladder_t) _mm512_mul_epu32((__m512i) (x), (__m512i) (y))
+#ifdef __AVX512F__
+#define avx512 1
+#else
+#define avx512 __builtin_cpu_supports("avx512f")
+#endif
+#endif
+
+#ifdef LADDERS
+typedef uint64_t ladder_t __attribute__((vector_size(8 * LADDERS)));
+typedef ladder_t vector_t[10];
+#endif
+
+enum {
+  batch = 64, combs = 16, spacing = 64 / combs,
+  steps = width - 2, digits = 256 / steps + 1
+};
+
+typedef struct {
+  uint64_t comb[combs + 1][8][3][4];
+  x25519_t point;
+  int ladder;
+} x25519_prepared_t;
+
+static const element_t zero = { 0 }, one = { 1 };
+
+static const element_t edwards_d = {
+  element(0x75eb4dca135978a3, 0x00700a4d4141d8ab,
+    0x8cc740797779e898, 0x52036cee2b6ffe73)
+};
 
 static const scalar_t scalar_l = {
   limb(0x5812631a5cf5d3ed), limb(0x14def9dea2f79cd6),
@@ -41,6 +114,338 @@ static const scalar_t scalar_r2 = {
   limb(0xceec73d217f5be65), limb(0x0399411b7c309a3d)
 };
 
+#if X25519_RADIX == 51
+
+static void propagate(element_t x) {
+  limb_t carry = 0;
+  for (int i = 0; i < terms; i++) {
+    x[i] += carry;
+    carry = x[i] >> 51, x[i] &= radix_mask;
+  }
+  x[0] += 19 * carry;
+}
+
+static void reduce(element_t out, dlimb_t accum[terms]) {
+  for (int i = 0; i < terms - 1; i++) {
+    accum[i + 1] += accum[i] >> 51;
+    out[i] = (limb_t) accum[i] & radix_mask;
+  }
+  dlimb_t carry = 19 * (accum[terms - 1] >> 51) + out[0];
+  out[terms - 1] = (limb_t) accum[terms - 1] & radix_mask;
+  out[0] = (limb_t) carry & radix_mask;
+  out[1] += carry >> 51;
+}
+
+static void add(element_t out, const element_t x, const element_t y) {
+  for (int i = 0; i < terms; i++)
+    out[i] = x[i] + y[i];
+}
+
+static void sub(element_t out, const element_t x, const element_t y) {
+  for (int i = 0; i < terms; i++)
+    out[i] = x[i] + (i ? 0x1ffffffffffffc : 0x1fffffffffffb4) - y[i];
+  propagate(out);
+}
+
+static void mul(element_t out, const element_t x, const element_t y) {
+  dlimb_t accum[terms] = { 0 };
+  for (int i = 0; i < terms; i++)
+    for (int j = 0; j < terms; j++)
+      accum[(i + j) % terms] += (dlimb_t) x[i]
+        * (i + j < terms ? y[j] : 19 * y[j]);
+  reduce(out, accum);
+}
+
+static void sqr(element_t out, const element_t x) {
+  dlimb_t accum[terms] = { 0 };
+  for (int i = 0; i < terms; i++) {
+    accum[2 * i % terms] += (dlimb_t) x[i] * (2 * i < terms ? x[i]
+      : 19 * x[i]);
+    for (int j = i + 1; j < terms; j++)
+      accum[(i + j) % terms] += (dlimb_t) x[i]
+        * (i + j < terms ? 2 * x[j] : 38 * x[j]);
+  }
+  reduce(out, accum);
+}
+
+static void mul1(element_t out, const element_t x, const limb_t y) {
+  dlimb_t accum[terms];
+  for (int i = 0; i < terms; i++)
+    accum[i] = (dlimb_t) x[i] * y;
+  reduce(out, accum);
+}
+
+static limb_t canon(element_t x) {
+  propagate(x);
+  propagate(x);
+
+  limb_t carry = (x[0] + 19) >> 51;
+  for (int i = 1; i < terms; i++)
+    carry = (x[i] + carry) >> 51;
+  x[0] += 19 * carry;
+
+  limb_t result = 0;
+  for (int i = 0; i < terms; i++) {
+    if (i + 1 < terms)
+      x[i + 1] += x[i] >> 51;
+    result |= x[i] &= radix_mask;
+  }
+  return ((dlimb_t) result - 1) >> width;
+}
+
+static void load(element_t out, const uint64_t in[4]) {
+  out[0] = in[0] & radix_mask;
+  out[1] = (in[0] >> 51 | in[1] << 13) & radix_mask;
+  out[2] = (in[1] >> 38 | in[2] << 26) & radix_mask;
+  out[3] = (in[2] >> 25 | in[3] << 39) & radix_mask;
+  out[4] = in[3] >> 12;
+}
+
+static void store(uint64_t out[4], const element_t in) {
+  element_t x;
+  memcpy(x, in, sizeof(element_t));
+  canon(x);
+
+  out[0] = x[0] | x[1] << 51;
+  out[1] = x[1] >> 13 | x[2] << 38;
+  out[2] = x[2] >> 26 | x[3] << 25;
+  out[3] = x[3] >> 39 | x[4] << 12;
+}
+
+#elif X25519_RADIX == 25
+
+/* Products are at most 64 bits even where 128-bit integers are available */
+
+static void propagate(element_t x) {
+  limb_t carry = 0;
+  for (int i = 0; i < terms; i++) {
+    x[i] += carry;
+    carry = x[i] >> radix_bits(i), x[i] &= radix_mask(i);
+  }
+  x[0] += 19 * carry;
+}
+
+static void reduce(element_t out, uint64_t accum[terms]) {
+  for (int i = 0; i < terms - 1; i++) {
+    accum[i + 1] += accum[i] >> radix_bits(i);
+    out[i] = (limb_t) accum[i] & radix_mask(i);
+  }
+  uint64_t carry = 19 * (accum[terms - 1] >> 25) + out[0];
+  out[terms - 1] = (limb_t) accum[terms - 1] & radix_mask(1);
+  out[0] = (limb_t) carry & radix_mask(0);
+  out[1] += carry >> 26;
+}
+
+static void add(element_t out, const element_t x, const element_t y) {
+  for (int i = 0; i < terms; i++)
+    out[i] = x[i] + y[i];
+}
+
+static void sub(element_t out, const element_t x, const element_t y) {
+  for (int i = 0; i < terms; i++)
+    out[i] = x[i] + (i & 1 ? 0x7fffffc : i ? 0xffffffc : 0xfffffb4) - y[i];
+  propagate(out);
+}
+
+/* Odd limbs are 25 bits, so a product of two lands one bit up. Terms
+   wrapping past 2^255 are summed apart and multiplied by 19 in 64 bits, as
+   19 times an unreduced limb can overflow 32 bits. Working column by column
+   keeps only two sums live for register-starved 32-bit targets, but gcc
+   will not unroll all hundred products unprompted. */
+
+static void mul(element_t out, const element_t x, const element_t y) {
+  uint64_t accum[terms];
+#pragma GCC unroll 10
+  for (int k = 0; k < terms; k++) {
+    uint64_t low = 0, high = 0;
+    for (int i = 0; i < terms; i++) {
+      int j = (k - i + terms) % terms;
+      uint64_t product = (uint64_t) x[i] * (i & j & 1 ? 2 * y[j] : y[j]);
+      if (i <= k)
+        low += product;
+      else
+        high += product;
+    }
+    accum[k] = low + 19 * high;
+  }
+  reduce(out, accum);
+}
+
+static void sqr(element_t out, const element_t x) {
+  uint64_t accum[terms];
+#pragma GCC unroll 10
+  for (int k = 0; k < terms; k++) {
+    uint64_t low = 0, high = 0;
+    for (int i = 0; i < terms; i++) {
+      int j = (k - i + terms) % terms;
+      if (i > j)
+        continue;
+      uint64_t product = (uint64_t) (i < j ? 2 * x[i] : x[i])
+        * (i & j & 1 ? 2 * x[j] : x[j]);
+      if (i <= k)
+        low += product;
+      else
+        high += product;
+    }
+    accum[k] = low + 19 * high;
+  }
+  reduce(out, accum);
+}
+
+static void mul1(element_t out, const element_t x, const limb_t y) {
+  uint64_t accum[terms];
+  for (int i = 0; i < terms; i++)
+    accum[i] = (uint64_t) x[i] * y;
+  reduce(out, accum);
+}
+
+static limb_t canon(element_t x) {
+  propagate(x);
+  propagate(x);
+
+  limb_t carry = (x[0] + 19) >> 26;
+  for (int i = 1; i < terms; i++)
+    carry = (x[i] + carry) >> radix_bits(i);
+  x[0] += 19 * carry;
+
+  limb_t result = 0;
+  for (int i = 0; i < terms; i++) {
+    if (i + 1 < terms)
+      x[i + 1] += x[i] >> radix_bits(i);
+    result |= x[i] &= radix_mask(i);
+  }
+  return ((dlimb_t) result - 1) >> width;
+}
+
+static void load(element_t out, const uint64_t in[4]) {
+  out[0] = in[0] & radix_mask(0);
+  out[1] = in[0] >> 26 & radix_mask(1);
+  out[2] = (in[0] >> 51 | in[1] << 13) & radix_mask(0);
+  out[3] = in[1] >> 13 & radix_mask(1);
+  out[4] = in[1] >> 38 & radix_mask(0);
+  out[5] = in[2] & radix_mask(1);
+  out[6] = in[2] >> 25 & radix_mask(0);
+  out[7] = (in[2] >> 51 | in[3] << 13) & radix_mask(1);
+  out[8] = in[3] >> 12 & radix_mask(0);
+  out[9] = in[3] >> 38;
+}
+
+static void store(uint64_t out[4], const element_t in) {
+  uint64_t x[terms];
+  element_t y;
+  memcpy(y, in, sizeof(element_t));
+  canon(y);
+  for (int i = 0; i < terms; i++)
+    x[i] = y[i];
+
+  out[0] = x[0] | x[1] << 26 | x[2] << 51;
+  out[1] = x[2] >> 13 | x[3] << 13 | x[4] << 38;
+  out[2] = x[5] | x[6] << 25 | x[7] << 51;
+  out[3] = x[7] >> 13 | x[8] << 12 | x[9] << 38;
+}
+
+#else /* X25519_RADIX */
+
+#if defined __x86_64__ && defined __SIZEOF_INT128__ && !defined X25519_PORTABLE
+#include <cpuid.h>
+#define MULX
+
+static int adx;
+
+__attribute__((constructor)) static void detect(void) {
+  unsigned int a, b, c, d;
+  if (__get_cpuid_count(7, 0, &a, &b, &c, &d))
+    adx = (b >> 8 & 1) && (b >> 19 & 1);
+}
+
+/* Fold r8-r15 with 2^256 = 38 then 2^255 = 19, matching propagate() */
+#define fold \
+    "movl $38, %%edx; xorl %%eax, %%eax\n" \
+    "mulxq %%r12, %%rax, %%rbx; adcxq %%rax, %%r8; adoxq %%rbx, %%r9\n" \
+    "mulxq %%r13, %%rax, %%rbx; adcxq %%rax, %%r9; adoxq %%rbx, %%r10\n" \
+    "mulxq %%r14, %%rax, %%rbx; adcxq %%rax, %%r10; adoxq %%rbx, %%r11\n" \
+    "mulxq %%r15, %%rax, %%r12; adcxq %%rax, %%r11\n" \
+    "movl $0, %%eax; adoxq %%rax, %%r12; adcxq %%rax, %%r12\n" \
+    "shldq $1, %%r11, %%r12; btrq $63, %%r11\n" \
+    "imulq $19, %%r12, %%r12; addq %%r12, %%r8\n" \
+    "adcq $0, %%r9; adcq $0, %%r10; adcq $0, %%r11\n" \
+    "movq %%r8, 0(%[out]); movq %%r9, 8(%[out])\n" \
+    "movq %%r10, 16(%[out]); movq %%r11, 24(%[out])\n"
+
+static void mulx_mul(element_t out, const element_t x, const element_t y) {
+  __asm__(
+    "movq 0(%[y]), %%rdx; mulxq 0(%[x]), %%r8, %%r9\n"
+    "mulxq 8(%[x]), %%rax, %%r10; addq %%rax, %%r9\n"
+    "mulxq 16(%[x]), %%rax, %%r11; adcq %%rax, %%r10\n"
+    "mulxq 24(%[x]), %%rax, %%r12; adcq %%rax, %%r11; adcq $0, %%r12\n"
+    "movq 8(%[y]), %%rdx; xorl %%r13d, %%r13d\n"
+    "mulxq 0(%[x]), %%rax, %%rbx; adcxq %%rax, %%r9; adoxq %%rbx, %%r10\n"
+    "mulxq 8(%[x]), %%rax, %%rbx; adcxq %%rax, %%r10; adoxq %%rbx, %%r11\n"
+    "mulxq 16(%[x]), %%rax, %%rbx; adcxq %%rax, %%r11; adoxq %%rbx, %%r12\n"
+    "mulxq 24(%[x]), %%rax, %%rbx; adcxq %%rax, %%r12; adoxq %%rbx, %%r13\n"
+    "adcq $0, %%r13\n"
+    "movq 16(%[y]), %%rdx; xorl %%r14d, %%r14d\n"
+    "mulxq 0(%[x]), %%rax, %%rbx; adcxq %%rax, %%r10; adoxq %%rbx, %%r11\n"
+    "mulxq 8(%[x]), %%rax, %%rbx; adcxq %%rax, %%r11; adoxq %%rbx, %%r12\n"
+    "mulxq 16(%[x]), %%rax, %%rbx; adcxq %%rax, %%r12; adoxq %%rbx, %%r13\n"
+    "mulxq 24(%[x]), %%rax, %%rbx; adcxq %%rax, %%r13; adoxq %%rbx, %%r14\n"
+    "adcq $0, %%r14\n"
+    "movq 24(%[y]), %%rdx; xorl %%r15d, %%r15d\n"
+    "mulxq 0(%[x]), %%rax, %%rbx; adcxq %%rax, %%r11; adoxq %%rbx, %%r12\n"
+    "mulxq 8(%[x]), %%rax, %%rbx; adcxq %%rax, %%r12; adoxq %%rbx, %%r13\n"
+    "mulxq 16(%[x]), %%rax, %%rbx; adcxq %%rax, %%r13; adoxq %%rbx, %%r14\n"
+    "mulxq 24(%[x]), %%rax, %%rbx; adcxq %%rax, %%r14; adoxq %%rbx, %%r15\n"
+    "adcq $0, %%r15\n"
+    fold
+    : : [out] "c" (out), [x] "S" (x), [y] "D" (y)
+    : "rax", "rbx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14",
+      "r15", "cc", "memory");
+}
+
+static void mulx_sqr(element_t out, const element_t x) {
+  __asm__(
+    "movq 0(%[x]), %%rdx; mulxq 8(%[x]), %%r9, %%r10\n"
+    "mulxq 16(%[x]), %%rax, %%r11; addq %%rax, %%r10\n"
+    "mulxq 24(%[x]), %%rax, %%r12; adcq %%rax, %%r11; adcq $0, %%r12\n"
+    "movq 8(%[x]), %%rdx; xorl %%r13d, %%r13d\n"
+    "mulxq 16(%[x]), %%rax, %%rbx; adcxq %%rax, %%r11; adoxq %%rbx, %%r12\n"
+    "mulxq 24(%[x]), %%rax, %%rbx; adcxq %%rax, %%r12; adoxq %%rbx, %%r13\n"
+    "adcq $0, %%r13\n"
+    "movq 16(%[x]), %%rdx; mulxq 24(%[x]), %%rax, %%r14\n"
+    "addq %%rax, %%r13; adcq $0, %%r14\n"
+    "xorl %%r15d, %%r15d; addq %%r9, %%r9; adcq %%r10, %%r10\n"
+    "adcq %%r11, %%r11; adcq %%r12, %%r12; adcq %%r13, %%r13\n"
+    "adcq %%r14, %%r14; adcq $0, %%r15\n"
+    "movq 0(%[x]), %%rdx; mulxq %%rdx, %%r8, %%rax; addq %%rax, %%r9\n"
+    "movq 8(%[x]), %%rdx; mulxq %%rdx, %%rax, %%rbx\n"
+    "adcq %%rax, %%r10; adcq %%rbx, %%r11\n"
+    "movq 16(%[x]), %%rdx; mulxq %%rdx, %%rax, %%rbx\n"
+    "adcq %%rax, %%r12; adcq %%rbx, %%r13\n"
+    "movq 24(%[x]), %%rdx; mulxq %%rdx, %%rax, %%rbx\n"
+    "adcq %%rax, %%r14; adcq %%rbx, %%r15\n"
+    fold
+    : : [out] "c" (out), [x] "S" (x)
+    : "rax", "rbx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14",
+      "r15", "cc", "memory");
+}
+
+static void mulx_mul1(element_t out, const element_t x, const limb_t y) {
+  __asm__(
+    "mulxq 0(%[x]), %%r8, %%r9\n"
+    "mulxq 8(%[x]), %%rax, %%r10; addq %%rax, %%r9\n"
+    "mulxq 16(%[x]), %%rax, %%r11; adcq %%rax, %%r10\n"
+    "mulxq 24(%[x]), %%rax, %%rbx; adcq %%rax, %%r11; adcq $0, %%rbx\n"
+    "shldq $1, %%r11, %%rbx; btrq $63, %%r11\n"
+    "imulq $19, %%rbx, %%rbx; addq %%rbx, %%r8\n"
+    "adcq $0, %%r9; adcq $0, %%r10; adcq $0, %%r11\n"
+    "movq %%r8, 0(%[out]); movq %%r9, 8(%[out])\n"
+    "movq %%r10, 16(%[out]); movq %%r11, 24(%[out])\n"
+    : : [out] "c" (out), [x] "S" (x), "d" (y)
+    : "rax", "rbx", "r8", "r9", "r10", "r11", "cc", "memory");
+}
+
+#endif /* __x86_64__ */
+
 static void propagate(element_t x, limb_t over) {
   over = x[limbs - 1] >> (width - 1) | over << 1;
   x[limbs - 1] &= ~((limb_t) 1 << (width - 1));
@@ -65,6 +470,13 @@ static void sub(element_t out, const element_t x, const element_t y) {
 }
 
 static void mul(element_t out, const element_t x, const element_t y) {
+#ifdef MULX
+  if (adx) {
+    mulx_mul(out, x, y);
+    return;
+  }
+#endif
+
   limb_t accum[2 * limbs] = { 0 };
   for (int i = 0; i < limbs; i++) {
     dlimb_t carry = 0;
@@ -83,7 +495,24 @@ static void mul(element_t out, const element_t x, const element_t y) {
   propagate(out, carry);
 }
 
+static void sqr(element_t out, const element_t x) {
+#ifdef MULX
+  if (adx) {
+    mulx_sqr(out, x);
+    return;
+  }
+#endif
+  mul(out, x, x);
+}
+
 static void mul1(element_t out, const element_t x, const limb_t y) {
+#ifdef MULX
+  if (adx) {
+    mulx_mul1(out, x, y);
+    return;
+  }
+#endif
+
   dlimb_t carry = 0;
   for (int i = 0; i < limbs; i++)
     out[i] = carry += (dlimb_t) y * x[i], carry >>= width;
@@ -93,13 +522,6 @@ static void mul1(element_t out, const element_t x, const limb_t y) {
   propagate(out, carry);
 }
 
-static void mulsqrn(element_t out, const element_t x, const element_t y,
-    uint8_t n) {
-  for (int i = 0; i < n; i++)
-    mul(out, x, x), x = out;
-  mul(out, out, y);
-}
-
 static limb_t canon(element_t x) {
   dlimb_t carry0 = 19;
   for (int i = 0; i < limbs; i++)
@@ -113,8 +535,28 @@ static limb_t canon(element_t x) {
   return ((dlimb_t) result - 1) >> width;
 }
 
+static void load(element_t out, const uint64_t in[4]) {
+  for (int i = 0; i < limbs; i++)
+    out[i] = (limb_t) (in[i * width / 64] >> (i * width % 64));
+}
+
+static void store(uint64_t out[4], const element_t in) {
+  memset(out, 0, 4 * sizeof(uint64_t));
+  for (int i = 0; i < limbs; i++)
+    out[i * width / 64] |= (uint64_t) in[i] << (i * width % 64);
+}
+
+#endif /* X25519_RADIX */
+
+static void mulsqrn(element_t out, const element_t x, const element_t y,
+    uint8_t n) {
+  for (int i = 0; i < n; i++)
+    sqr(out, x), x = out;
+  mul(out, out, y);
+}
+
 static void condswap(element_t x, element_t y, limb_t mask) {
-  for (int i = 0; i < limbs; i++) {
+  for (int i = 0; i < terms; i++) {
     limb_t xor = (x[i] ^ y[i]) & mask;
     x[i] ^= xor, y[i] ^= xor;
   }
@@ -122,8 +564,8 @@ static void condswap(element_t x, element_t y, limb_t mask) {
 
 static limb_t invsqrt(element_t out, const element_t x) {
   const element_t sqrtm1 = {
-    limb(0xc4ee1b274a0ea0b0), limb(0x2f431806ad2fe478),
-    limb(0x2b4d00993dfbd7a7), limb(0x2b8324804fc1df0b)
+    element(0xc4ee1b274a0ea0b0, 0x2f431806ad2fe478,
+      0x2b4d00993dfbd7a7, 0x2b8324804fc1df0b)
   };
 
   element_t u, v, y, z;
@@ -139,7 +581,7 @@ static limb_t invsqrt(element_t out, const element_t x) {
   mulsqrn(z, u, u, 125);
   mulsqrn(z, z, x, 2);
 
-  mul(y, z, z);
+  sqr(y, z);
   mul(y, y, x);
   add(u, y, one);
   add(v, y, sqrtm1);
@@ -162,8 +604,8 @@ static void ladder1(element_t x2, element_t z2, element_t x3, element_t z3,
   mul(x2, x2, z2);
   add(x3, z3, x2);
   sub(z3, z3, x2);
-  mul(t1, t1, t1);
-  mul(z2, z2, z2);
+  sqr(t1, t1);
+  sqr(z2, z2);
   sub(x2, t1, z2);
   mul1(z2, x2, a24);
   add(z2, z2, t1);
@@ -171,9 +613,9 @@ static void ladder1(element_t x2, element_t z2, element_t x3, element_t z3,
 
 static void ladder2(const element_t x1, element_t x2, element_t z2,
     element_t x3, element_t z3, const element_t t1) {
-  mul(z3, z3, z3);
+  sqr(z3, z3);
   mul(z3, z3, x1);
-  mul(x3, x3, x3);
+  sqr(x3, x3);
   mul(z2, z2, x2);
   sub(x2, t1, x2);
   mul(x2, x2, t1);
@@ -229,12 +671,26 @@ static void put(x25519_t out, const limb_t in[limbs]) {
   }
 }
 
+static void unpack(element_t out, const x25519_t in) {
+  uint64_t words[4] = { 0 };
+  for (int i = 0; i < 32; i++)
+    words[i >> 3] |= (uint64_t) in[i] << (i & 7) * 8;
+  load(out, words);
+}
+
+static void pack(x25519_t out, const element_t in) {
+  uint64_t words[4];
+  store(words, in);
+  for (int i = 0; i < 32; i++)
+    out[i] = words[i >> 3] >> (i & 7) * 8;
+}
+
 static void x25519_core(element_t x2, element_t z2, const x25519_t scalar,
     const x25519_t point) {
   element_t x1, x3, z3, t1;
   limb_t swap = 0;
 
-  get(x1, point);
+  unpack(x1, point);
   memcpy(x2, one, sizeof(element_t));
   memcpy(z2, zero, sizeof(element_t));
   memcpy(x3, x1, sizeof(element_t));
@@ -254,70 +710,1599 @@ static void x25519_core(element_t x2, element_t z2, const x25519_t scalar,
   condswap(z2, z3, swap);
 }
 
-int x25519(x25519_t out, const x25519_t scalar, const x25519_t point) {
-  element_t t, u, v, x, z;
-  x25519_core(x, z, scalar, point);
+#ifdef LADDERS
 
-  mulsqrn(u, z, z, 1);
-  mulsqrn(u, u, z, 1);
-  mulsqrn(v, u, u, 3);
-  mulsqrn(u, v, v, 6);
-  mulsqrn(t, u, z, 1);
-  mulsqrn(t, t, u, 12);
-  mulsqrn(v, t, t, 25);
-  mulsqrn(u, v, t, 25);
-  mulsqrn(u, u, v, 50);
-  mulsqrn(t, u, u, 125);
-  mulsqrn(t, t, z, 2);
-  mulsqrn(t, t, z, 2);
-  mulsqrn(t, t, z, 1);
+vector static void vcarry(vector_t out, vector_t h) {
+  for (int i = 0; i < 10; i++) {
+    ladder_t carry = h[i] >> (26 - (i & 1));
+    out[i] = h[i] & ((1 << (26 - (i & 1))) - 1);
+    if (i < 9)
+      h[i + 1] += carry;
+    else
+      h[0] = out[0] + 19 * carry;
+  }
+  out[1] += h[0] >> 26;
+  out[0] = h[0] & ((1 << 26) - 1);
+}
+
+vector static void vadd(vector_t out, const vector_t x, const vector_t y) {
+  for (int i = 0; i < 10; i++)
+    out[i] = x[i] + y[i];
+}
+
+vector static void vsub(vector_t out, const vector_t x, const vector_t y) {
+  vector_t h;
+  for (int i = 0; i < 10; i++)
+    h[i] = x[i] - y[i] + (i == 0 ? 0xfffffb4 : i & 1 ? 0x7fffffc : 0xffffffc);
+  vcarry(out, h);
+}
+
+vector static void vmul(vector_t out, const vector_t x, const vector_t y) {
+  vector_t h, x2, y19;
+
+  for (int i = 0; i < 10; i++)
+    x2[i] = x[i] << (i & 1), y19[i] = 19 * y[i];
+
+  for (int i = 0; i < 10; i++) {
+    const ladder_t *z = i & 1 ? x : x2;
+    h[i] = vmulu(z[0], y[i]);
+    for (int j = 1; j <= i; j++)
+      h[i] += vmulu(z[j], y[i - j]);
+    for (int j = i + 1; j < 10; j++)
+      h[i] += vmulu(z[j], y19[i + 10 - j]);
+  }
+  vcarry(out, h);
+}
+
+vector static void vsqr(vector_t out, const vector_t x) {
+  vector_t h = { 0 }, x2, x4, x19;
+
+  for (int i = 0; i < 10; i++)
+    x2[i] = x[i] << 1, x4[i] = x[i] << 2, x19[i] = 19 * x[i];
+
+  for (int i = 0; i < 10; i++) {
+    h[2 * i % 10] += vmulu(i & 1 ? x2[i] : x[i], i < 5 ? x[i] : x19[i]);
+    for (int j = i + 1; j < 10 - i; j++)
+      h[i + j] += vmulu(i & j & 1 ? x4[i] : x2[i], x[j]);
+    for (int j = i + 1 > 10 - i ? i + 1 : 10 - i; j < 10; j++)
+      h[i + j - 10] += vmulu(i & j & 1 ? x4[i] : x2[i], x19[j]);
+  }
+  vcarry(out, h);
+}
+
+vector static void vmul1(vector_t out, const vector_t x, uint32_t y) {
+  vector_t h;
+  for (int i = 0; i < 10; i++)
+    h[i] = vmulu(x[i], (ladder_t) { 0 } + y);
+  vcarry(out, h);
+}
+
+vector static void vswap(vector_t x, vector_t y, ladder_t mask) {
+  for (int i = 0; i < 10; i++) {
+    ladder_t xor = (x[i] ^ y[i]) & mask;
+    x[i] ^= xor, y[i] ^= xor;
+  }
+}
+
+vector static void vget(vector_t out, int lane, const x25519_t in) {
+  uint32_t word[9] = { 0 };
+  for (int i = 0; i < 32; i++)
+    word[i >> 2] |= (uint32_t) in[i] << (i & 3) * 8;
+
+  for (int i = 0, offset = 0; i < 10; offset += 26 - (i & 1), i++) {
+    uint64_t bits = (uint64_t) word[offset / 32 + 1] << 32 | word[offset / 32];
+    out[i][lane] = bits >> offset % 32 & ((1 << (26 - (i & 1))) - 1);
+  }
+  out[0][lane] += 19 * (word[7] >> 31);
+}
+
+vector static void vput(element_t out, const vector_t in, int lane) {
+  uint32_t word[8];
+  uint64_t words[4], accum = 0;
+
+  for (int i = 0, bits = 0, w = 0; i < 10; i++) {
+    accum += (uint64_t) in[i][lane] << bits;
+    bits += 26 - (i & 1);
+    if (bits >= 32 || i == 9)
+      word[w++] = accum, accum >>= 32, bits -= 32;
+  }
+
+  for (int i = 0; i < 4; i++)
+    words[i] = (uint64_t) word[2 * i + 1] << 32 | word[2 * i];
+  load(out, words);
+}
+
+vector static void x25519_ladders(element_t x[], element_t z[],
+    const x25519_t scalar[], const x25519_t point[], size_t count) {
+  vector_t x1, x2, z2, x3, z3, a, b, c, d;
+  ladder_t mask, swap = { 0 };
+
+  for (int l = 0; l < LADDERS; l++)
+    vget(x1, l, l < (int) count ? point[l] : x25519_base);
+  for (int i = 0; i < 10; i++) {
+    x2[i] = z3[i] = (ladder_t) { 0 } + (i == 0);
+    z2[i] = (ladder_t) { 0 }, x3[i] = x1[i];
+  }
+
+  for (int i = 255; i >= 0; i--) {
+    ladder_t bit = { 0 };
+    for (size_t l = 0; l < count; l++)
+      bit[l] = scalar[l][i >> 3] >> (i & 7) & 1;
+    mask = swap ^ -bit, swap = -bit;
+    vswap(x2, x3, mask);
+    vswap(z2, z3, mask);
+
+    vadd(a, x2, z2);
+    vsub(b, x2, z2);
+    vadd(c, x3, z3);
+    vsub(d, x3, z3);
+    vmul(d, d, a);
+    vmul(c, c, b);
+    vadd(x3, d, c);
+    vsub(z3, d, c);
+    vsqr(x3, x3);
+    vsqr(z3, z3);
+    vmul(z3, z3, x1);
+
+    vsqr(a, a);
+    vsqr(b, b);
+    vmul(x2, a, b);
+    vsub(b, a, b);
+    vmul1(c, b, 121665);
+    vadd(c, c, a);
+    vmul(z2, b, c);
+  }
+  vswap(x2, x3, swap);
+  vswap(z2, z3, swap);
+
+  for (size_t l = 0; l < count; l++) {
+    vput(x[l], x2, l);
+    vput(z[l], z2, l);
+  }
+}
+
+#endif /* LADDERS */
+
+static const uint64_t niels[combs][8][3][4] = {
+  {
+    {
+      { 0x2fbc93c6f58c3b85, 0xcf932dc6fb8c0e19,
+        0x270b4898643d42c2, 0x07cf9d3a33d4ba65 },
+      { 0x9d103905d740913e, 0xfd399f05d140beb3,
+        0xa5c18434688f8a09, 0x44fd2f9298f81267 },
+      { 0xabc91205877aaa68, 0x26d9e823ccaac49e,
+        0x5a1b7dcbdd43598c, 0x6f117b689f0c65a8 }
+    }, {
+      { 0x9224e7fc933c71d7, 0x9f469d967a0ff5b5,
+        0x5aa69a65e1d60702, 0x590c063fa87d2e2e },
+      { 0x8a99a56042b4d5a8, 0x8f2b810c4e60acf6,
+        0xe09e236bb16e37aa, 0x6bb595a669c92555 },
+      { 0x43faa8b3a59b7a5f, 0x36c16bdd5d9acf78,
+        0x500fa0840b3d6a31, 0x701af5b13ea50b73 }
+    }, {
+      { 0xaf25b0a84cee9730, 0x025a8430e8864b8a,
+        0xc11b50029f016732, 0x7a164e1b9a80f8f4 },
+      { 0x56611fe8a4fcd265, 0x3bd353fde5c1ba7d,
+        0x8131f31a214bd6bd, 0x2ab91587555bda62 },
+      { 0x14ae933f0dd0d889, 0x589423221c35da62,
+        0xd170e5458cf2db4c, 0x5a2826af12b9b4c6 }
+    }, {
+      { 0x287351b98efc099f, 0x6765c6f47dfd2538,
+        0xca348d3dfb0a9265, 0x680e910321e58727 },
+      { 0x95fe050a056818bf, 0x327e89715660faa9,
+        0xc3e8e3cd06a05073, 0x27933f4c7445a49a },
+      { 0x5a13fbe9c476ff09, 0x6e9e39457b5cc172,
+        0x5ddbdcf9102b4494, 0x7f9d0cbf63553e2b }
+    }, {
+      { 0xa212bc4408a5bb33, 0x8d5048c3c75eed02,
+        0xdd1beb0c5abfec44, 0x2945ccf146e206eb },
+      { 0x7f9182c3a447d6ba, 0xd50014d14b2729b7,
+        0xe33cf11cb864a087, 0x154a7e73eb1b55f3 },
+      { 0xbcbbdbf1812a8285, 0x270e0807d0bdd1fc,
+        0xb41b670b1bbda72d, 0x43aabe696b3bb69a }
+    }, {
+      { 0x3a0ceeeb77157131, 0x9b27158900c8af88,
+        0x8065b668da59a736, 0x51e57bb6a2cc38bd },
+      { 0x499806b67b7d8ca4, 0x575be28427d22739,
+        0xbb085ce7204553b9, 0x38b64c41ae417884 },
+      { 0x85ac326702ea4b71, 0xbe70e00341a1bb01,
+        0x53e4a24b083bc144, 0x10b8e91a9f0d61e3 }
+    }, {
+      { 0x6b1a5cd0944ea3bf, 0x7470353ab39dc0d2,
+        0x71b2528228542e49, 0x461bea69283c927e },
+      { 0xba6f2c9aaa3221b1, 0x6ca021533bba23a7,
+        0x9dea764f92192c3a, 0x1d6edd5d2e5317e0 },
+      { 0xf1836dc801b8b3a2, 0xb3035f47053ea49a,
+        0x529c41ba5877adf3, 0x7a9fbb1c6a0f90a7 }
+    }, {
+      { 0x59b7596604dd3e8f, 0x6cb30377e288702c,
+        0xb1339c665ed9c323, 0x0915e76061bce52f },
+      { 0xe2a75dedf39234d9, 0x963d7680e1b558f9,
+        0x2c2741ac6e3c23fb, 0x3a9024a1320e01c3 },
+      { 0xe7c1f5d9c9a2911a, 0xb8a371788bcca7d7,
+        0x636412190eb62a32, 0x26907c5c2ecc4e95 }
+    }
+  }, {
+    {
+      { 0x7e234c597c6691ae, 0x64889d3d0a85b4c8,
+        0xdae2c90c354afae7, 0x0a871e070c6a9e1d },
+      { 0x40e87d44744346be, 0x1d48dad415b52b25,
+        0x7c3a8a18a13b603e, 0x4eb728c12fcdbdf7 },
+      { 0x3301b5994bbc8989, 0x736bae3a5bdd4260,
+        0x0d61ade219d59e3c, 0x3ee7300f2685d464 }
+    }, {
+      { 0x43fa7947841e7518, 0xe5c6fa59639c46d7,
+        0xa1065e1de3052b74, 0x7d47c6a2cfb89030 },
+      { 0xf5d255e49e7dd6b7, 0x8016115c610b1eac,
+        0x3c99975d92e187ca, 0x13815762979125c2 },
+      { 0x3fdad0148ef0d6e0, 0x9d3e749a91546f3c,
+        0x71ec621026bb8157, 0x148cf58d34c9ec80 }
+    }, {
+      { 0xe2572f7d9ae4756d, 0x56c345bb88f3487f,
+        0x9fd10b6d6960a88d, 0x278febad4eaea1b9 },
+      { 0x46a492f67934f027, 0x469984bef6840aa9,
+        0x5ca1bc2a89611854, 0x3ff2fa1ebd5dbbd4 },
+      { 0xb1aa681f8c933966, 0x8c21949c20290c98,
+        0x39115291219d3c52, 0x4104dd02fe9c677b }
+    }, {
+      { 0x81214e06db096ab8, 0x21a8b6c90ce44f35,
+        0x6524c12a409e2af5, 0x0165b5a48efca481 },
+      { 0x72b2bf5e1124422a, 0xa1fa0c3398a33ab5,
+        0x94cb6101fa52b666, 0x2c863b00afaf53d5 },
+      { 0xf190a474a0846a76, 0x12eff984cd2f7cc0,
+        0x695e290658aa2b8f, 0x591b67d9bffec8b8 }
+    }, {
+      { 0x99b9b3719f18b55d, 0xe465e5faa18c641e,
+        0x61081136c29f05ed, 0x489b4f867030128b },
+      { 0x312f0d1c80b49bfa, 0x5979515eabf3ec8a,
+        0x727033c09ef01c88, 0x3de02ec7ca8f7bcb },
+      { 0xd232102d3aeb92ef, 0xe16253b46116a861,
+        0x3d7eabe7190baa24, 0x49f5fbba496cbebf }
+    }, {
+      { 0x155d628c1e9c572e, 0x8a4d86acc5884741,
+        0x91a352f6515763eb, 0x06a1a6c28867515b },
+      { 0x30949a108a5bcfd4, 0xdc40dd70bc6473eb,
+        0x92c294c1307c0d1c, 0x5604a86dcbfa6e74 },
+      { 0x7288d1d47c1764b6, 0x72541140e0418b51,
+        0x9f031a6018acf6d1, 0x20989e89fe2742c6 }
+    }, {
+      { 0x1674278b85eaec2e, 0x5621dc077acb2bdf,
+        0x640a4c1661cbf45a, 0x730b9950f70595d3 },
+      { 0x499777fd3a2dcc7f, 0x32857c2ca54fd892,
+        0xa279d864d207e3a0, 0x0403ed1d0ca67e29 },
+      { 0xc94b2d35874ec552, 0xc5e6c8cf98246f8d,
+        0xf7cb46fa16c035ce, 0x5bd7454308303dcc }
+    }, {
+      { 0x85c4932115e7792a, 0xc64c89a2bdcdddc9,
+        0x9d1e3da8ada3d762, 0x5bb7db123067f82c },
+      { 0x7f9ad19528b24cc2, 0x7f6b54656335c181,
+        0x66b8b66e4fc07236, 0x133a78007380ad83 },
+      { 0x0961f467c6ca62be, 0x04ec21d6211952ee,
+        0x182360779bd54770, 0x740dca6d58f0e0d2 }
+    }
+  }, {
+    {
+      { 0x8765b69f7b85c5e8, 0x6ff0678bd168bab2,
+        0x3a70e77c1d330f9b, 0x3a5f6d51b0af8e7c },
+      { 0x61368756a60dac5f, 0x17e02f6aebabdc57,
+        0x7f193f2d4cce0f7d, 0x20234a7789ecdcf0 },
+      { 0x76d20db67178b252, 0x071c34f9d51ed160,
+        0xf62a4a20b3e41170, 0x7cd682353cffe366 }
+    }, {
+      { 0xa665cd6068acf4f3, 0x42d92d183cd7e3d3,
+        0x5759389d336025d9, 0x3ef0253b2b2cd8ff },
+      { 0x0be1a45bd887fab6, 0x2a846a32ba403b6e,
+        0xd9921012e96e6000, 0x2838c8863bdc0943 },
+      { 0xd16bb0cf4a465030, 0xfa496b4115c577ab,
+        0x82cfae8af4ab419d, 0x21dcb8a606a82812 }
+    }, {
+      { 0x9a8d00fabe7731ba, 0x8203607e629e1889,
+        0xb2cc023743f3d97f, 0x5d840dbf6c6f678b },
+      { 0x5c6004468c9d9fc8, 0x2540096ed42aa3cb,
+        0x125b4d4c12ee2f9c, 0x0bc3d08194a31dab },
+      { 0x706e380d309fe18b, 0x6eb02da6b9e165c7,
+        0x57bbba997dae20ab, 0x3a4276232ac196dd }
+    }, {
+      { 0x3bf8c172db447ecb, 0x5fcfc41fc6282dbd,
+        0x80acffc075aa15fe, 0x0770c9e824e1a9f9 },
+      { 0x4b42432c8a7084fa, 0x898a19e3dfb9e545,
+        0xbe9f00219c58e45d, 0x1ff177cea16debd1 },
+      { 0xcf61d99a45b5b5fd, 0x860984e91b3a7924,
+        0xe7300919303e3e89, 0x39f264fd41500b1e }
+    }, {
+      { 0xd19b4aabfe097be1, 0xa46dfce1dfe01929,
+        0xc3c908942ca6f1ff, 0x65c621272c35f14e },
+      { 0xa7ad3417dbe7e29c, 0xbd94376a2b9c139c,
+        0xa0e91b8e93597ba9, 0x1712d73468889840 },
+      { 0xe72b89f8ce3193dd, 0x4d103356a125c0bb,
+        0x0419a93d2e1cfe83, 0x22f9800ab19ce272 }
+    }, {
+      { 0x42029fdd9a6efdac, 0xb912cebe34a54941,
+        0x640f64b987bdf37b, 0x4171a4d38598cab4 },
+      { 0x605a368a3e9ef8cb, 0xe3e9c022a5504715,
+        0x553d48b05f24248f, 0x13f416cd647626e5 },
+      { 0xfa2758aa99c94c8c, 0x23006f6fb000b807,
+        0xfbd291ddadda5392, 0x508214fa574bd1ab }
+    }, {
+      { 0x461a15bb53d003d6, 0xb2102888bcf3c965,
+        0x27c576756c683a5a, 0x3a7758a4c86cb447 },
+      { 0xc20269153ed6fe4b, 0xa65a6739511d77c4,
+        0xcbde26462c14af94, 0x22f960ec6faba74b },
+      { 0x548111f693ae5076, 0x1dae21df1dfd54a6,
+        0x12248c90f3115e65, 0x5d9fd15f8de7f494 }
+    }, {
+      { 0x3f244d2aeed7521e, 0x8e3a9028432e9615,
+        0xe164ba772e9c16d4, 0x3bc187fa47eb98d8 },
+      { 0x031408d36d63727f, 0x6a379aefd7c7b533,
+        0xa9e18fc5ccaee24b, 0x332f35914f8fbed3 },
+      { 0x6d470115ea86c20c, 0x998ab7cb6c46d125,
+        0xd77832b53a660188, 0x450d81ce906fba03 }
+    }
+  }, {
+    {
+      { 0x9fe62b434f460efb, 0xded303d4a63607d6,
+        0xf052210eb7a0da24, 0x237e7dbe00545b93 },
+      { 0xce16f74bc53c1431, 0x2b9725ce2072edde,
+        0xb8b9c36fb5b23ee7, 0x7e2e0e450b5cc908 },
+      { 0x013575ed6701b430, 0x231094e69f0bfd10,
+        0x75320f1583e47f22, 0x71afa699b11155e3 }
+    }, {
+      { 0xea423c1c473b50d6, 0x51e87a1f3b38ef10,
+        0x9b84bf5fb2c9be95, 0x00731fbc78f89a1c },
+      { 0x65ce6f9b3953b61d, 0xc65839eaafa141e6,
+        0x0f435ffda9f759fe, 0x021142e9c2b1c28e },
+      { 0xe430c71848f81880, 0xbf960c225ecec119,
+        0xb6dae0836bba15e3, 0x4c4d6f3347e15808 }
+    }, {
+      { 0x2f0cddfc988f1970, 0x6b916227b0b9f51b,
+        0x6ec7b6c4779176be, 0x38bf9500a88f9fa8 },
+      { 0x18f7eccfc17d1fc9, 0x6c75f5a651403c14,
+        0xdbde712bf7ee0cdf, 0x193fddaaa7e47a22 },
+      { 0x1fd2c93c37e8876f, 0xa2f61e5a18d1462c,
+        0x5080f58239241276, 0x6a6fb99ebf0d4969 }
+    }, {
+      { 0xeeb122b5b6e423c6, 0x939d7010f286ff8e,
+        0x90a92a831dcf5d8c, 0x136fda9f42c5eb10 },
+      { 0x6a46c1bb560855eb, 0x2416bb38f893f09d,
+        0xd71d11378f71acc1, 0x75f76914a31896ea },
+      { 0xf94cdfb1a305bdd1, 0x0f364b9d9ff82c08,
+        0x2a87d8a5c3bb588a, 0x022183510be8dcba }
+    }, {
+      { 0x9d5a710143307a7f, 0xb063de9ec47da45f,
+        0x22bbfe52be927ad3, 0x1387c441fd40426c },
+      { 0x4af766385ead2d14, 0xa08ed880ca7c5830,
+        0x0d13a6e610211e3d, 0x6a071ce17b806c03 },
+      { 0xb5d3c3d187978af8, 0x722b5a3d7f0e4413,
+        0x0d7b4848bb477ca0, 0x3171b26aaf1edc92 }
+    }, {
+      { 0xa60db7d8b28a47d1, 0xa6bf14d61770a4f1,
+        0xd4a1f89353ddbd58, 0x6c514a63344243e9 },
+      { 0xa92f319097564ca8, 0xff7bb84c2275e119,
+        0x4f55fe37a4875150, 0x221fd4873cf0835a },
+      { 0x2322204f3a156341, 0xfb73e0e9ba0a032d,
+        0xfce0dd4c410f030e, 0x48daa596fb924aaa }
+    }, {
+      { 0x14f61d5dc84c9793, 0x9941f9e3ef418206,
+        0xcdf5b88f346277ac, 0x58c837fa0e8a79a9 },
+      { 0x6eca8e665ca59cc7, 0xa847254b2e38aca0,
+        0x31afc708d21e17ce, 0x676dd6fccad84af7 },
+      { 0x0cf9688596fc9058, 0x1ddcbbf37b56a01b,
+        0xdcc2e77d4935d66a, 0x1c4f73f2c6a57f0a }
+    }, {
+      { 0xb36e706efc7c3484, 0x73dfc9b4c3c1cf61,
+        0xeb1d79c9781cc7e5, 0x70459adb7daf675c },
+      { 0x0e7a4fbd305fa0bb, 0x829d4ce054c663ad,
+        0xf421c3832fe33848, 0x795ac80d1bf64c42 },
+      { 0x1b91db4991b42bb3, 0x572696234b02dcca,
+        0x9fdf9ee51f8c78dc, 0x5fe162848ce21fd3 }
+    }
+  }, {
+    {
+      { 0xcd2a65e777d1f515, 0x548991878faa60f1,
+        0xb1b73bbcdabc06e5, 0x654878cba97cc9fb },
+      { 0x51138ec78df6b0fe, 0x5397da89e575f51b,
+        0x09207a1d717af1b9, 0x2102fdba2b20d650 },
+      { 0x969ee405055ce6a1, 0x36bca7681251ad29,
+        0x3a1af517aa7da415, 0x0ad725db29ecb2ba }
+    }, {
+      { 0xfec7bc0c9b056f85, 0x537d5268e7f5ffd7,
+        0x77afc6624312aefa, 0x4f675f5302399fd9 },
+      { 0xdc4267b1834e2457, 0xb67544b570ce1bc5,
+        0x1af07a0bf7d15ed7, 0x4aefcffb71a03650 },
+      { 0xc32d36360415171e, 0xcd2bef118998483b,
+        0x870a6eadd0945110, 0x0bccbb72a2a86561 }
+    }, {
+      { 0x186d5e4c50fe1296, 0xe0397b82fee89f7e,
+        0x3bc7f6c5507031b0, 0x6678fd69108f37c2 },
+      { 0x185e962feab1a9c8, 0x86e7e63565147dcd,
+        0xb092e031bb5b6df2, 0x4024f0ab59d6b73e },
+      { 0x1586fa31636863c2, 0x07f68c48572d33f2,
+        0x4f73cc9f789eaefc, 0x2d42e2108ead4701 }
+    }, {
+      { 0x21717b0d0f537593, 0x914e690b131e064c,
+        0x1bb687ae752ae09f, 0x420bf3a79b423c6e },
+      { 0x97f5131594dfd29b, 0x6155985d313f4c6a,
+        0xeba13f0708455010, 0x676b2608b8d2d322 },
+      { 0x8138ba651c5b2b47, 0x8671b6ec311b1b80,
+        0x7bff0cb1bc3135b0, 0x745d2ffa9c0cf1e0 }
+    }, {
+      { 0x6036df5721d34e6a, 0xb1db8827997bb3d0,
+        0xd3c209c3c8756afa, 0x06e15be54c1dc839 },
+      { 0xbf525a1e2bc9c8bd, 0xea5b260826479d81,
+        0xd511c70edf0155db, 0x1ae23ceb960cf5d0 },
+      { 0x5b725d871932994a, 0x32351cb5ceb1dab0,
+        0x7dc41549dab7ca05, 0x58ded861278ec1f7 }
+    }, {
+      { 0x2dfb5ba8b6c2c9a8, 0x48eeef8ef52c598c,
+        0x33809107f12d1573, 0x08ba696b531d5bd8 },
+      { 0xd8173793f266c55c, 0xc8c976c5cc454e49,
+        0x5ce382f8bc26c3a8, 0x2ff39de85485f6f9 },
+      { 0x77ed3eeec3efc57a, 0x04e05517d4ff4811,
+        0xea3d7a3ff1a671cb, 0x120633b4947cfe54 }
+    }, {
+      { 0x82bd31474912100a, 0xde237b6d7e6fbe06,
+        0xe11e761911ea79c6, 0x07433be3cb393bde },
+      { 0x0b94987891610042, 0x4ee7b13cecebfae8,
+        0x70be739594f0a4c0, 0x35d30a99b4d59185 },
+      { 0xff7944c05ce997f4, 0x575d3de4b05c51a3,
+        0x583381fd5a76847c, 0x2d873ede7af6da9f }
+    }, {
+      { 0xaa6202e14e5df981, 0xa20d59175015e1f5,
+        0x18a275d3bae21d6c, 0x0543618a01600253 },
+      { 0x157a316443373409, 0xfab8b7eef4aa81d9,
+        0xb093fee6f5a64806, 0x2e773654707fa7b6 },
+      { 0x0deabdf4974c23c1, 0xaa6f0a259dce4693,
+        0x04202cb8a29aba2c, 0x4b1443362d07960d }
+    }
+  }, {
+    {
+      { 0x2798aaf9b4b75601, 0x5eac72135c8dad72,
+        0xd2ceaa6161b7a023, 0x1bbfb284e98f7d4e },
+      { 0x89f5058a382b33f3, 0x5ae2ba0bad48c0b4,
+        0x8f93b503a53db36e, 0x5aa3ed9d95a232e6 },
+      { 0x656777e9c7d96561, 0xcb2b125472c78036,
+        0x65053299d9506eee, 0x4a07e14e5e8957cc }
+    }, {
+      { 0x240b58cdc477a49b, 0xfd38dade6447f017,
+        0x19928d32a7c86aad, 0x50af7aed84afa081 },
+      { 0x4ee412cb980df999, 0xa315d76f3c6ec771,
+        0xbba5edde925c77fd, 0x3f0bac391d313402 },
+      { 0x6e4fde0115f65be5, 0x29982621216109b2,
+        0x780205810badd6d9, 0x1921a316baebd006 }
+    }, {
+      { 0xd75aad9ad9f3c18b, 0x566a0eef60b1c19c,
+        0x3e9a0bac255c0ed9, 0x7b049deca062c7f5 },
+      { 0x89422f7edfb870fc, 0x2c296beb4f76b3bd,
+        0x0738f1d436c24df7, 0x6458df41e273aeb0 },
+      { 0xdccbe37a35444483, 0x758879330fedbe93,
+        0x786004c312c5dd87, 0x6093dccbc2950e64 }
+    }, {
+      { 0x6bdeeebe6084034b, 0x3199c2b6780fb854,
+        0x973376abb62d0695, 0x6e3180c98b647d90 },
+      { 0x1ff39a8585e0706d, 0x36d0a5d8b3e73933,
+        0x43b9f2e1718f453b, 0x57d1ea084827a97c },
+      { 0xee7ab6e7a128b071, 0xa4c1596d93a88baa,
+        0xf7b4de82b2216130, 0x363e999ddd97bd18 }
+    }, {
+      { 0x2f1848dce24baec6, 0x769b7255babcaf60,
+        0x90cb3c6e3cefe931, 0x231f979bc6f9b355 },
+      { 0x96a843c135ee1fc4, 0x976eb35508e4c8cf,
+        0xb42f6801b58cd330, 0x48ee9b78693a052b },
+      { 0x5c31de4bcc2af3c6, 0xb04bb030fe208d1f,
+        0xb78d7009c14fb466, 0x079bfa9b08792413 }
+    }, {
+      { 0xf3c9ed80a2d54245, 0x0aa08b7877f63952,
+        0xd76dac63d1085475, 0x1ef4fb159470636b },
+      { 0xe3903a51da300df4, 0x843964233da95ab0,
+        0xed3cf12d0b356480, 0x038c77f684817194 },
+      { 0x854e5ee65b167bec, 0x59590a4296d0cdc2,
+        0x72b2df3498102199, 0x575ee92a4a0bff56 }
+    }, {
+      { 0x5d46bc450aa4d801, 0xc3af1227a533b9d8,
+        0x389e3b262b8906c2, 0x200a1e7e382f581b },
+      { 0xd4c080908a182fcf, 0x30e170c299489dbd,
+        0x05babd5752f733de, 0x43d4e7112cd3fd00 },
+      { 0x518db967eaf93ac5, 0x71bc989b056652c0,
+        0xfe2b85d9567197f5, 0x050eca52651e4e38 }
+    }, {
+      { 0x97ac397660e668ea, 0x9b19bbfe153ab497,
+        0x4cb179b534eca79f, 0x6151c09fa131ae57 },
+      { 0xc3431ade453f0c9c, 0xe9f5045eff703b9b,
+        0xfcd97ac9ed847b3d, 0x4b0ee6c21c58f4c6 },
+      { 0x3af55c0dfdf05d96, 0xdd262ee02ab4ee7a,
+        0x11b2bb8712171709, 0x1fef24fa800f030b }
+    }
+  }, {
+    {
+      { 0xd598639c12ddb0a4, 0xa5d19f30c024866b,
+        0xd17c2f0358fce460, 0x07a195152e095e8a },
+      { 0x296fa9c59c2ec4de, 0xbc8b61bf4f84f3cb,
+        0x1c7706d917a8f908, 0x63b795fc7ad3255d },
+      { 0xa8368f02389e5fc8, 0x90433b02cf8de43b,
+        0xafa1fd5dc5412643, 0x3e8fe83d032f0137 }
+    }, {
+      { 0x08704c8de8efd13c, 0xdfc51a8e33e03731,
+        0xa59d5da51260cde3, 0x22d60899a6258c86 },
+      { 0x2f8b15b90570a294, 0x94f2427067084549,
+        0xde1c5ae161bbfd84, 0x75ba3b797fac4007 },
+      { 0x6239dbc070cdd196, 0x60fe8a8b6c7d8a9a,
+        0xb38847bceb401260, 0x0904d07b87779e5e }
+    }, {
+      { 0xf4322d6648f940b9, 0x06952f0cbd2d0c39,
+        0x167697ada081f931, 0x6240aacebaf72a6c },
+      { 0xb4ce1fd4ddba919c, 0xcf31db3ec74c8daa,
+        0x2c63cc63ad86cc51, 0x43e2143fbc1dde07 },
+      { 0xf834749c5ba295a0, 0xd6947c5bca37d25a,
+        0x66f13ba7e7c9316a, 0x56bdaf238db40cac }
+    }, {
+      { 0x1310d36cc19d3bb2, 0x062a6bb7622386b9,
+        0x7c9b8591d7a14f5c, 0x03aa31507e1e5754 },
+      { 0x362ab9e3f53533eb, 0x338568d56eb93d40,
+        0x9e0e14521d5a5572, 0x1d24a86d83741318 },
+      { 0xf4ec7648ffd4ce1f, 0xe045eaf054ac8c1c,
+        0x88d225821d09357c, 0x43b261dc9aeb4859 }
+    }, {
+      { 0x19513d8b6c951364, 0x94fe7126000bf47b,
+        0x028d10ddd54f9567, 0x02b4d5e242940964 },
+      { 0xe55b1e1988bb79bb, 0xa09ed07dc17a359d,
+        0xb02c2ee2603dea33, 0x326055cf5b276bc2 },
+      { 0xb4a155cb28d18df2, 0xeacc4646186ce508,
+        0xc49cf4936c824389, 0x27a6c809ae5d3410 }
+    }, {
+      { 0xcd2c270ac43d6954, 0xdd4a3e576a66cab2,
+        0x79fa592469d7036c, 0x221503603d8c2599 },
+      { 0x8ba6ebcd1f0db188, 0x37d3d73a675a5be8,
+        0xf22edfa315f5585a, 0x2cb67174ff60a17e },
+      { 0x59eecdf9390be1d0, 0xa9422044728ce3f1,
+        0x82891c667a94f0f4, 0x7b1df4b73890f436 }
+    }, {
+      { 0x5f2e221807f8f58c, 0xe3555c9fd49409d4,
+        0xb2aaa88d1fb6a630, 0x68698245d352e03d },
+      { 0xe492f2e0b3b2a224, 0x7c6c9e062b551160,
+        0x15eb8fe20d7f7b0e, 0x61fcef2658fc5992 },
+      { 0xdbb15d852a18187a, 0xf3e4aad386ddacd7,
+        0x44bae2810ff6c482, 0x46cf4c473daf01cf }
+    }, {
+      { 0x213c6ea7f1498140, 0x7c1e7ef8392b4854,
+        0x2488c38c5629ceba, 0x1065aae50d8cc5bb },
+      { 0x426525ed9ec4e5f9, 0x0e5eda0116903303,
+        0x72b1a7f2cbe5cadc, 0x29387bcd14eb5f40 },
+      { 0x1c2c4525df200d57, 0x5c3b2dd6bfca674a,
+        0x0a07e7b1e1834030, 0x69a198e64f1ce716 }
+    }
+  }, {
+    {
+      { 0xd6cfd1ef5fddc09c, 0xe82b3efdf7575dce,
+        0x25d56b5d201634c2, 0x3041c6bb04ed2b9b },
+      { 0xda7c2b256768d593, 0x98c1c0574422ca13,
+        0xf1a80bd5ca0ace1d, 0x29cdd1adc088a690 },
+      { 0x0ff2f2f9d956e148, 0xade797759f356b2e,
+        0x1a4698bb5f6c025c, 0x104bbd6814049a7b }
+    }, {
+      { 0xa95d9a5fd67ff163, 0xe92be69d4cc75681,
+        0xb7f8024cde20f257, 0x204f2a20fb072df5 },
+      { 0x51f0fd3168f1ed67, 0x2c811dcdd86f3bc2,
+        0x44dc5c4304d2f2de, 0x5be8cc57092a7149 },
+      { 0xc8143b3d30ebb079, 0x7589155abd652e30,
+        0x653c3c318f6d5c31, 0x2570fb17c279161f }
+    }, {
+      { 0x192ea9550bb8245a, 0xc8e6fba88f9050d1,
+        0x7986ea2d88a4c935, 0x241c5f91de018668 },
+      { 0x3efa367f2cb61575, 0xf5f96f761cd6026c,
+        0xe8c7142a65b52562, 0x3dcb65ea53030acd },
+      { 0x28d8172940de6caa, 0x8fbf2cf022d9733a,
+        0x16d7fcdd235b01d1, 0x08420edd5fcdf0e5 }
+    }, {
+      { 0x0358c34e04f410ce, 0xb6135b5a276e0685,
+        0x5d9670c7ebb91521, 0x04d654f321db889c },
+      { 0xcdff20ab8362fa4a, 0x57e118d4e21a3e6e,
+        0xe3179617fc39e62b, 0x0d9a53efbc1769fd },
+      { 0x5e7dc116ddbdb5d5, 0x2954deb68da5dd2d,
+        0x1cb608173334a292, 0x4a7a4f2618991ad7 }
+    }, {
+      { 0x24c3b291af372a4b, 0x93da8270718147f2,
+        0xdd84856486899ef2, 0x4a96314223e0ee33 },
+      { 0xf4a718025fb15f95, 0x3df65f346b5c1b8f,
+        0xcdfcf08500e01112, 0x11b50c4cddd31848 },
+      { 0xa6e8274408a4ffd6, 0x738e177e9c1576d9,
+        0x773348b63d02b3f2, 0x4f4bce4dce6bcc51 }
+    }, {
+      { 0x30e2616ec49d0b6f, 0xe456718fcaec2317,
+        0x48eb409bf26b4fa6, 0x3042cee561595f37 },
+      { 0xa71fce5ae2242584, 0x26ea725692f58a9e,
+        0xd21a09d71cea3cf4, 0x73fcdd14b71c01e6 },
+      { 0x427e7079449bac41, 0x855ae36dbce2310a,
+        0x4cae76215f841a7c, 0x389e740c9a9ce1d6 }
+    }, {
+      { 0xc9bd78f6570eac28, 0xe55b0b3227919ce1,
+        0x65fc3eaba19b91ed, 0x25c425e5d6263690 },
+      { 0x64fcb3ae34dcb9ce, 0x97500323e348d0ad,
+        0x45b3f07d62c6381b, 0x61545379465a6788 },
+      { 0x3f3e06a6f1d7de6e, 0x3ef976278e062308,
+        0x8c14f6264e8a6c77, 0x6539a08915484759 }
+    }, {
+      { 0xddc4dbd414bb4a19, 0x19b2bc3c98424f8e,
+        0x48a89fd736ca7169, 0x0f65320ef019bd90 },
+      { 0xe9d21f74c3d2f773, 0xc150544125c46845,
+        0x624e5ce8f9b99e33, 0x11c5e4aac5cd186c },
+      { 0xd486d1b1cafde0c6, 0x4f3fe6e3163b5181,
+        0x59a8af0dfaf2939a, 0x4cabc7bdec33072a }
+    }
+  }, {
+    {
+      { 0x583b04bfacad8ea2, 0x29b743e8148be884,
+        0x2b1e583b0810c5db, 0x2b5449e58eb3bbaa },
+      { 0x5f3a7562eb3dbe47, 0xf7ea38548ebda0b8,
+        0x00c3e53145747299, 0x1304e9e71627d551 },
+      { 0x789814d26adc9cfe, 0x3c1bab3f8b48dd0b,
+        0xda0fe1fff979c60a, 0x4468de2d7c2dd693 }
+    }, {
+      { 0x4b9ad8c6f86307ce, 0x21113531435d0c28,
+        0xd4a866c5657a772c, 0x5da6427e63247352 },
+      { 0x51bb355e9419469e, 0x33e6dc4c23ddc754,
+        0x93a5b6d6447f9962, 0x6cce7c6ffb44bd63 },
+      { 0x1a94c688deac22ca, 0xb9066ef7bbae1ff8,
+        0x88ad8c388d59580f, 0x58f29abfe79f2ca8 }
+    }, {
+      { 0x4b5a64bf710ecdf6, 0xb14ce538462c293c,
+        0x3643d056d50b3ab9, 0x6af93724185b4870 },
+      { 0xe90ecfab8de73e68, 0x54036f9f377e76a5,
+        0xf0495b0bbe015982, 0x577629c4a7f41e36 },
+      { 0x3220024509c6a888, 0xd2e036134b558973,
+        0x83e236233c33289f, 0x701f25bb0caec18f }
+    }, {
+      { 0x9d18f6d97cbec113, 0x844a06e674bfdbe4,
+        0x20f5b522ac4e60d6, 0x720a5bc050955e51 },
+      { 0xc3a8b0f8e4616ced, 0xf700660e9e25a87d,
+        0x61e3061ff4bca59c, 0x2e0c92bfbdc40be9 },
+      { 0x0c3f09439b805a35, 0xe84e8b376242abfc,
+        0x691417f35c229346, 0x0e9b9cbb144ef0ec }
+    }, {
+      { 0x8dee9bd55db1beee, 0xc9c3ab370a723fb9,
+        0x44a8f1bf1c68d791, 0x366d44191cfd3cde },
+      { 0xfbbad48ffb5720ad, 0xee81916bdbf90d0e,
+        0xd4813152635543bf, 0x221104eb3f337bd8 },
+      { 0x9e3c1743f2bc8c14, 0x2eda26fcb5856c3b,
+        0xccb82f0e68a7fb97, 0x4167a4e6bc593244 }
+    }, {
+      { 0xc2be2665f8ce8fee, 0xe967ff14e880d62c,
+        0xf12e6e7e2f364eee, 0x34b33370cb7ed2f6 },
+      { 0x643b9d2876f62700, 0x5d1d9d400e7668eb,
+        0x1b4b430321fc0684, 0x7938bb7e2255246a },
+      { 0xcdc591ee8681d6cc, 0xce02109ced85a753,
+        0xed7485c158808883, 0x1176fc6e2dfe65e4 }
+    }, {
+      { 0xdb90e28949770eb8, 0x98fbcc2aacf440a3,
+        0x21354ffeded7879b, 0x1f6a3e54f26906b6 },
+      { 0xb4af6cd05b9c619b, 0x2ddfc9f4b2a58480,
+        0x3d4fa502ebe94dc4, 0x08fc3a4c677d5f34 },
+      { 0x60a4c199d30734ea, 0x40c085b631165cd6,
+        0xe2333e23f7598295, 0x4f2fad0116b900d1 }
+    }, {
+      { 0x962cd91db73bb638, 0xe60577aafc129c08,
+        0x6f619b39f3b61689, 0x3451995f2944ee81 },
+      { 0x44beb24194ae4e54, 0x5f541c511857ef6c,
+        0xa61e6b2d368d0498, 0x445484a4972ef7ab },
+      { 0x9152fcd09fea7d7c, 0x4a816c94b0935cf6,
+        0x258e9aaa47285c40, 0x10b89ca6042893b7 }
+    }
+  }, {
+    {
+      { 0x9c18fcfa36048d13, 0x29159db373899ddd,
+        0xdc9f350b9f92d0aa, 0x26f57eee878a19d4 },
+      { 0x559a0cc9782a0dde, 0x551dcdb2ea718385,
+        0x7f62865b31ef238c, 0x504aa7767973613d },
+      { 0x0cab2cd55687efb1, 0x5180d162247af17b,
+        0x85c15a344f5a2467, 0x4041943d9dba3069 }
+    }, {
+      { 0x4b217743a26caadd, 0x47a6b424648ab7ce,
+        0xcb1d4f7a03fbc9e3, 0x12d931429800d019 },
+      { 0xc3c0eeba43ebcc96, 0x8d749c9c26ea9caf,
+        0xd9fa95ee1c77ccc6, 0x1420a1d97684340f },
+      { 0x00c67799d337594f, 0x5e3c5140b23aa47b,
+        0x44182854e35ff395, 0x1b4f92314359a012 }
+    }, {
+      { 0x33cf3030a49866b1, 0x251f73d2215f4859,
+        0xab82aa4051def4f6, 0x5ff191d56f9a23f6 },
+      { 0x3e5c109d89150951, 0x39cefa912de9696a,
+        0x20eae43f975f3020, 0x239b572a7f132dae },
+      { 0x819ed433ac2d9068, 0x2883ab795fc98523,
+        0xef4572805593eb3d, 0x020c526a758f36cb }
+    }, {
+      { 0xe931ef59f042cc89, 0x2c589c9d8e124bb6,
+        0xadc8e18aaec75997, 0x452cfe0a5602c50c },
+      { 0x779834f89ed8dbbc, 0xc8f2aaf9dc7ca46c,
+        0xa9524cdca3e1b074, 0x02aacc4615313877 },
+      { 0x86a0f7a0647877df, 0xbbc464270e607c9f,
+        0xab17ea25f1fb11c9, 0x4cfb7d7b304b877b }
+    }, {
+      { 0xe28699c29789ef12, 0x2b6ecd71df57190d,
+        0xc343c857ecc970d0, 0x5b1d4cbc434d3ac5 },
+      { 0x72b43d6cb89b75fe, 0x54c694d99c6adc80,
+        0xb8c3aa373ee34c9f, 0x14b4622b39075364 },
+      { 0xb6fb2615cc0a9f26, 0x3a4f0e2bb88dcce5,
+        0x1301498b3369a705, 0x2f98f71258592dd1 }
+    }, {
+      { 0x2e12ae444f54a701, 0xfcfe3ef0a9cbd7de,
+        0xcebf890d75835de0, 0x1d8062e9e7614554 },
+      { 0x0c94a74cb50f9e56, 0x5b1ff4a98e8e1320,
+        0x9a2acc2182300f67, 0x3a6ae249d806aaf9 },
+      { 0x657ada85a9907c5a, 0x1a0ea8b591b90f62,
+        0x8d0e1dfbdf34b4e9, 0x298b8ce8aef25ff3 }
+    }, {
+      { 0x837a72ea0a2165de, 0x3fab07b40bcf79f6,
+        0x521636c77738ae70, 0x6ba6271803a7d7dc },
+      { 0x2a927953eff70cb2, 0x4b89c92a79157076,
+        0x9418457a30a7cf6a, 0x34b8a8404d5ce485 },
+      { 0xc26eecb583693335, 0xd5a813df63b5fefd,
+        0xa293aa9aa4b22573, 0x71d62bdd465e1c6a }
+    }, {
+      { 0xcd2db5dab1f75ef5, 0xd77f95cf16b065f5,
+        0x14571fea3f49f085, 0x1c333621262b2b3d },
+      { 0x6533cc28d378df80, 0xf6db43790a0fa4b4,
+        0xe3645ff9f701da5a, 0x74d5f317f3172ba4 },
+      { 0xa86fe55467d9ca81, 0x398b7c752b298c37,
+        0xda6d0892e3ac623b, 0x4aebcc4547e9d98c }
+    }
+  }, {
+    {
+      { 0x96eebffb305b2f51, 0xd3f938ad889596b8,
+        0xf0f52dc746d5dd25, 0x57968290bb3a0095 },
+      { 0x4637974e8c58aedc, 0xb9ef22fbabf041a4,
+        0xe185d956e980718a, 0x2f1b78fab143a8a6 },
+      { 0xf71ab8430a20e101, 0xf393658d24f0ec47,
+        0xcf7509a86ee2eed1, 0x7dc43e35dc2aa3e1 }
+    }, {
+      { 0x5a782a5c273e9718, 0x3576c6995e4efd94,
+        0x0f2ed8051f237d3e, 0x044fb81d82d50a99 },
+      { 0x85966665887dd9c3, 0xc90f9b314bb05355,
+        0xc6e08df8ef2079b1, 0x7ef72016758cc12f },
+      { 0xc1df18c5a907e3d9, 0x57b3371dce4c6359,
+        0xca704534b201bb49, 0x7f79823f9c30dd2e }
+    }, {
+      { 0x6a9c1ff068f587ba, 0x0827894e0050c8de,
+        0x3cbf99557ded5be7, 0x64a9b0431c06d6f0 },
+      { 0x8334d239a3b513e8, 0xc13670d4b91fa8d8,
+        0x12b54136f590bd33, 0x0a4e0373d784d9b4 },
+      { 0x2eb3d6a15b7d2919, 0xb0b4f6a0d53a8235,
+        0x7156ce4389a45d47, 0x071a7d0ace18346c }
+    }, {
+      { 0xcc0c355220e14431, 0x0d65950709b15141,
+        0x9af5621b209d5f36, 0x7c69bcf7617755d3 },
+      { 0xd3072daac887ba0b, 0x01262905bfa562ee,
+        0xcf543002c0ef768b, 0x2c3bcc7146ea7e9c },
+      { 0x07f0d7eb04e8295f, 0x10db18252f50f37d,
+        0xe951a9a3171798d7, 0x6f5a9a7322aca51d }
+    }, {
+      { 0xe729d4eba3d944be, 0x8d9e09408078af9e,
+        0x4525567a47869c03, 0x02ab9680ee8d3b24 },
+      { 0x8ba1000c2f41c6c5, 0xc49f79c10cfefb9b,
+        0x4efa47703cc51c9f, 0x494e21a2e147afca },
+      { 0xefa48a85dde50d9a, 0x219a224e0fb9a249,
+        0xfa091f1dd91ef6d9, 0x6b5d76cbea46bb34 }
+    }, {
+      { 0xe0f941171e782522, 0xf1e6ae74036936d3,
+        0x408b3ea2d0fcc746, 0x16fb869c03dd313e },
+      { 0x8857556cec0cd994, 0x6472dc6f5cd01dba,
+        0xaf0169148f42b477, 0x0ae333f685277354 },
+      { 0x288e199733b60962, 0x24fc72b4d8abe133,
+        0x4811f7ed0991d03e, 0x3f81e38b8f70d075 }
+    }, {
+      { 0x0adb7f355f17c824, 0x74b923c3d74299a4,
+        0xd57c3e8bcbf8eaf7, 0x0ad3e2d34cdedc3d },
+      { 0x7f910fcc7ed9affe, 0x545cb8a12465874b,
+        0xa8397ed24b0c4704, 0x50510fc104f50993 },
+      { 0x6f0c0fc5336e249d, 0x745ede19c331cfd9,
+        0xf2d6fd0009eefe1c, 0x127c158bf0fa1ebe }
+    }, {
+      { 0xdea28fc4ae51b974, 0x1d9973d3744dfe96,
+        0x6240680b873848a8, 0x4ed82479d167df95 },
+      { 0xf6197c422e9879a2, 0xa44addd452ca3647,
+        0x9b413fc14b4eaccb, 0x354ef87d07ef4f68 },
+      { 0xfee3b52260c5d975, 0x50352efceb41b0b8,
+        0x8808ac30a9f6653c, 0x302d92d20539236d }
+    }
+  }, {
+    {
+      { 0xa2b4dae0b5511c9a, 0x7ac860292bffff06,
+        0x981f375df5504234, 0x3f6bd725da4ea12d },
+      { 0xeb18b9ab7f5745c6, 0x023a8aee5787c690,
+        0xb72712da2df7afa9, 0x36597d25ea5c013d },
+      { 0x734d8d7b106058ac, 0xd940579e6fc6905f,
+        0x6466f8f99202932d, 0x7b7ecc19da60d6d0 }
+    }, {
+      { 0x6dae4a51a77cfa9b, 0x82263654e7a38650,
+        0x09bbffcd8f2d82db, 0x03bedc661bf5caba },
+      { 0x78c2373c695c690d, 0xdd252e660642906e,
+        0x951d44444ae12bd2, 0x4235ad7601743956 },
+      { 0x6258cb0d078975f5, 0x492942549189f298,
+        0xa0cab423e2e36ee4, 0x0e7ce2b0cdf066a1 }
+    }, {
+      { 0xfea6fedfd94b70f9, 0xf130c051c1fcba2d,
+        0x4882d47e7f2fab89, 0x615256138aeceeb5 },
+      { 0xc494643ac48c85a3, 0xfd361df43c6139ad,
+        0x09db17dd3ae94d48, 0x666e0a5d8fb4674a },
+      { 0x2abbf64e4870cb0d, 0xcd65bcf0aa458b6b,
+        0x9abe4eba75e8985d, 0x7f0bc810d514dee4 }
+    }, {
+      { 0x83ac9dad737213a0, 0x9ff6f8ba2ef72e98,
+        0x311e2edd43ec6957, 0x1d3a907ddec5ab75 },
+      { 0xb9006ba426f4136f, 0x8d67369e57e03035,
+        0xcbc8dfd94f463c28, 0x0d1f8dbcf8eedbf5 },
+      { 0xba1693313ed081dc, 0x29329fad851b3480,
+        0x0128013c030321cb, 0x00011b44a31bfde3 }
+    }, {
+      { 0x16561f696a0aa75c, 0xc1bf725c5852bd6a,
+        0x11a8dd7f9a7966ad, 0x63d988a2d2851026 },
+      { 0x3fdfa06c3fc66c0c, 0x5d40e38e4dd60dd2,
+        0x7ae38b38268e4d71, 0x3ac48d916e8357e1 },
+      { 0x00120753afbd232e, 0xe92bceb8fdd8f683,
+        0xf81669b384e72b91, 0x33fad52b2368a066 }
+    }, {
+      { 0x8d2cc8d0c422cfe8, 0x072b4f7b05a13acb,
+        0xa3feb6e6ecf6a56f, 0x3cc355ccb90a71e2 },
+      { 0x540649c6c5e41e16, 0x0af86430333f7735,
+        0xb2acfcd2f305e746, 0x16c0f429a256dca7 },
+      { 0xe9b69443903e9131, 0xb8a494cb7a5637ce,
+        0xc87cd1a4baba9244, 0x631eaf426bae7568 }
+    }, {
+      { 0x47d975b9a3700de8, 0x7280c5fbe2f80552,
+        0x53658f2732e45de1, 0x431f2c7f665f80b5 },
+      { 0xb3e90410da66fe9f, 0x85dd4b526c16e5a6,
+        0xbc3d97611ef9bf83, 0x5599648b1ea919b5 },
+      { 0xd6026344858f7b19, 0x14ab352fa1ea514a,
+        0x8900441a2090a9d7, 0x7b04715f91253b26 }
+    }, {
+      { 0xb376c280c4e6bac6, 0x970ed3dd6d1d9b0b,
+        0xb09a9558450bf944, 0x48d0acfa57cde223 },
+      { 0x83edbd28acf6ae43, 0x86357c8b7d5c7ab4,
+        0xc0404769b7eb2c44, 0x59b37bf5c2f6583f },
+      { 0xb60f26e47dabe671, 0xf1d1a197622f3a37,
+        0x4208ce7ee9960394, 0x16234191336d3bdb }
+    }
+  }, {
+    {
+      { 0xa66dcc9dc80c1ac0, 0x97a05cf41b38a436,
+        0xa7ebf3be95dbd7c6, 0x7da0b8f68d7e7dab },
+      { 0xef782014385675a6, 0xa2649f30aafda9e8,
+        0x4cd1eb505cdfa8cb, 0x46115aba1d4dc0b3 },
+      { 0xd40f1953c3b5da76, 0x1dac6f7321119e9b,
+        0x03cc6021feb25960, 0x5a5f887e83674b4b }
+    }, {
+      { 0x9e9628d3a0a643b9, 0xb5c3cb00e6c32064,
+        0x9b5302897c2dec32, 0x43e37ae2d5d1c70c },
+      { 0x8f6301cf70a13d11, 0xcfceb815350dd0c4,
+        0xf70297d4a4bca47e, 0x3669b656e44d1434 },
+      { 0x387e3f06eda6e133, 0x67301d5199a13ac0,
+        0xbd5ad8f836263811, 0x6a21e6cd4fd5e9be }
+    }, {
+      { 0xef4129126699b2e3, 0x71d30847708d1301,
+        0x325432d01182b0bd, 0x45371b07001e8b36 },
+      { 0xf1c6170a3046e65f, 0x58712a2a00d23524,
+        0x69dbbd3c8c82b755, 0x586bf9f1a195ff57 },
+      { 0xa6db088d5ef8790b, 0x5278f0dc610937e5,
+        0xac0349d261a16eb8, 0x0eafb03790e52179 }
+    }, {
+      { 0x5140805e0f75ae1d, 0xec02fbe32662cc30,
+        0x2cebdf1eea92396d, 0x44ae3344c5435bb3 },
+      { 0x960555c13748042f, 0x219a41e6820baa11,
+        0x1c81f73873486d0c, 0x309acc675a02c661 },
+      { 0x9cf289b9bba543ee, 0xf3760e9d5ac97142,
+        0x1d82e5c64f9360aa, 0x62d5221b7f94678f }
+    }, {
+      { 0x7585d4263af77a3c, 0xdfae7b11fee9144d,
+        0xa506708059f7193d, 0x14f29a5383922037 },
+      { 0x524c299c18d0936d, 0xc86bb56c8a0c1a0c,
+        0xa375052edb4a8631, 0x5c0efde4bc754562 },
+      { 0xdf717edc25b2d7f5, 0x21f970db99b53040,
+        0xda9234b7c3ed4c62, 0x5e72365c7bee093e }
+    }, {
+      { 0x7d9339062f08b33e, 0x5b9659e5df9f32be,
+        0xacff3dad1f9ebdfd, 0x70b20555cb7349b7 },
+      { 0x575bfc074571217f, 0x3779675d0694d95b,
+        0x9a0a37bbf4191e33, 0x77f1104c47b4eabc },
+      { 0xbe5113c555112c4c, 0x6688423a9a881fcd,
+        0x446677855e503b47, 0x0e34398f4a06404a }
+    }, {
+      { 0x18930b093e4b1928, 0x7de3e10e73f3f640,
+        0xf43217da73395d6f, 0x6f8aded6ca379c3e },
+      { 0xb67d22d93ecebde8, 0x09b3e84127822f07,
+        0x743fa61fb05b6d8d, 0x5e5405368a362372 },
+      { 0xe340123dfdb7b29a, 0x487b97e1a21ab291,
+        0xf9967d02fde6949e, 0x780de72ec8d3de97 }
+    }, {
+      { 0x671feaf300f42772, 0x8f72eb2a2a8c41aa,
+        0x29a17fd797373292, 0x1defc6ad32b587a6 },
+      { 0x0ae28545089ae7bc, 0x388ddecf1c7f4d06,
+        0x38ac15510a4811b8, 0x0eb28bf671928ce4 },
+      { 0xaf5bbe1aef5195a7, 0x148c1277917b15ed,
+        0x2991f7fb7ae5da2e, 0x467d201bf8dd2867 }
+    }
+  }, {
+    {
+      { 0xf3aa57a22796bb14, 0x883abab79b07da21,
+        0xe54be21831a0391c, 0x5ee7fb38d83205f9 },
+      { 0x9adc0ff9ce5ec54b, 0x039c2a6b8c2f130d,
+        0x028007c7f0f89515, 0x78968314ac04b36b },
+      { 0x538dfdcb41446a8e, 0xa5acfda9434937f9,
+        0x46af908d263c8c78, 0x61d0633c9bca0d09 }
+    }, {
+      { 0xada328bcf8fc73df, 0xee84695da6f037fc,
+        0x637fb4db38c2a909, 0x5b23ac2df8067bdc },
+      { 0x63744935ffdb2566, 0xc5bd6b89780b68bb,
+        0x6f1b3280553eec03, 0x6e965fd847aed7f5 },
+      { 0x9ad2b953ee80527b, 0xe88f19aafade6d8d,
+        0x0e711704150e82cf, 0x79b9bbb9dd95dedc }
+    }, {
+      { 0xd1997dae8e9f7374, 0xa032a2f8cfbb0816,
+        0xcd6cba126d445f0a, 0x1ba811460accb834 },
+      { 0xebb355406a3126c2, 0xd26383a868c8c393,
+        0x6c0c6429e5b97a82, 0x5065f158c9fd2147 },
+      { 0x708169fb0c429954, 0xe14600acd76ecf67,
+        0x2eaab98a70e645ba, 0x3981f39e58a4faf2 }
+    }, {
+      { 0xc845dfa56de66fde, 0xe152a5002c40483a,
+        0xe9d2e163c7b4f632, 0x30f4452edcbc1b65 },
+      { 0x18fb8a7559230a93, 0x1d168f6960e6f45d,
+        0x3a85a94514a93cb5, 0x38dc083705acd0fd },
+      { 0x856d2782c5759740, 0xfa134569f99cbecc,
+        0x8844fc73c0ea4e71, 0x632d9a1a593f2469 }
+    }, {
+      { 0xbf09fd11ed0c84a7, 0x63f071810d9f693a,
+        0x21908c2d57cf8779, 0x3a5a7df28af64ba2 },
+      { 0xf6bb6b15b807cba6, 0x1823c7dfbc54f0d7,
+        0xbb1d97036e29670b, 0x0b24f48847ed4a57 },
+      { 0xdcdad4be511beac7, 0xa4538075ed26ccf2,
+        0xe19cff9f005f9a65, 0x34fcf74475481f63 }
+    }, {
+      { 0xa5bb1dab78cfaa98, 0x5ceda267190b72f2,
+        0x9309c9110a92608e, 0x0119a3042fb374b0 },
+      { 0xc197e04c789767ca, 0xb8714dcb38d9467d,
+        0x55de888283f95fa8, 0x3d3bdc164dfa63f7 },
+      { 0x67a2d89ce8c2177d, 0x669da5f66895d0c1,
+        0xf56598e5b282a2b0, 0x56c088f1ede20a73 }
+    }, {
+      { 0x581b5fac24f38f02, 0xa90be9febae30cbd,
+        0x9a2169028acf92f0, 0x038b7ea48359038f },
+      { 0x336d3d1110a86e17, 0xd7f388320b75b2fa,
+        0xf915337625072988, 0x09674c6b99108b87 },
+      { 0x9f4ef82199316ff8, 0x2f49d282eaa78d4f,
+        0x0971a5ab5aef3174, 0x6e5e31025969eb65 }
+    }, {
+      { 0x3304fb0e63066222, 0xfb35068987acba3f,
+        0xbd1924778c1061a3, 0x3058ad43d1838620 },
+      { 0xb16c62f587e593fb, 0x4999eddeca5d3e71,
+        0xb491c1e014cc3e6d, 0x08f5114789a8dba8 },
+      { 0x323c0ffde57663d0, 0x05c3df38a22ea610,
+        0xbdc78abdac994f9a, 0x26549fa4efe3dc99 }
+    }
+  }, {
+    {
+      { 0xbb2e00c9193b877f, 0xece3a890e0dc506b,
+        0xecf3b7c036de649f, 0x5f46040898de9e1a },
+      { 0x739d8845832fcedb, 0xfa38d6c9ae6bf863,
+        0x32bc0dcab74ffef7, 0x73937e8814bce45e },
+      { 0xb9037116297bf48d, 0xa9d13b22d4f06834,
+        0xe19715574696bdc6, 0x2cf8a4e891d5e835 }
+    }, {
+      { 0x2cb5487e17d06ba2, 0x24d2381c3950196b,
+        0xd7659c8185978a30, 0x7a6f7f2891d6a4f6 },
+      { 0x6d93fd8707110f67, 0xdd4c09d37c38b549,
+        0x7cb16a4cc2736a86, 0x2049bd6e58252a09 },
+      { 0x7d09fd8d6a9aef49, 0xf0ee60be5b3db90b,
+        0x4c21b52c519ebfd4, 0x6011aadfc545941d }
+    }, {
+      { 0x63ded0c802cbf890, 0xfbd098ca0dff6aaa,
+        0x624d0afdb9b6ed99, 0x69ce18b779340b1e },
+      { 0x5f67926dcf95f83c, 0x7c7e856171289071,
+        0xd6a1e7f3998f7a5b, 0x6fc5cc1b0b62f9e0 },
+      { 0xd1ef5528b29879cb, 0xdd1aae3cd47e9092,
+        0x127e0442189f2352, 0x15596b3ae57101f1 }
+    }, {
+      { 0x09ff31167e5124ca, 0x0be4158bd9c745df,
+        0x292b7d227ef556e5, 0x3aa4e241afb6d138 },
+      { 0x462739d23f9179a2, 0xff83123197d6ddcf,
+        0x1307deb553f2148a, 0x0d2237687b5f4dda },
+      { 0x2cc138bf2a3305f5, 0x48583f8fa2e926c3,
+        0x083ab1a25549d2eb, 0x32fcaa6e4687a36c }
+    }, {
+      { 0x3207a4732787ccdf, 0x17e31908f213e3f8,
+        0xd5b2ecd7f60d964e, 0x746f6336c2600be9 },
+      { 0x7bc56e8dc57d9af5, 0x3e0bd2ed9df0bdf2,
+        0xaac014de22efe4a3, 0x4627e9cefebd6a5c },
+      { 0x3f4af345ab6c971c, 0xe288eb729943731f,
+        0x33596a8a0344186d, 0x7b4917007ed66293 }
+    }, {
+      { 0x54341b28dd53a2dd, 0xaa17905bdf42fc3f,
+        0x0ff592d94dd2f8f4, 0x1d03620fe08cd37d },
+      { 0x2d85fb5cab84b064, 0x497810d289f3bc14,
+        0x476adc447b15ce0c, 0x122ba376f844fd7b },
+      { 0xc20232cda2b4e554, 0x9ed0fd42115d187f,
+        0x2eabb4be7dd479d9, 0x02c70bf52b68ec4c }
+    }, {
+      { 0xace532bf458d72e1, 0x5be768e07cb73cb5,
+        0x56cf7d94ee8bbde7, 0x6b0697e3feb43a03 },
+      { 0xa287ec4b5d0b2fbb, 0x415c5790074882ca,
+        0xe044a61ec1d0815c, 0x26334f0a409ef5e0 },
+      { 0xb6c8f04adf62a3c0, 0x3ef000ef076da45d,
+        0x9c9cb95849f0d2a9, 0x1cc37f43441b2fae }
+    }, {
+      { 0xd76656f1c9ceaeb9, 0x1c5b15f818e5656a,
+        0x26e72832844c2334, 0x3a346f772f196838 },
+      { 0x508f565a5cc7324f, 0xd061c4c0e506a922,
+        0xfb18abdb5c45ac19, 0x6c6809c10380314a },
+      { 0xd2d55112e2da6ac8, 0xe9bd0331b1e851ed,
+        0x960746dd8ec67262, 0x05911b9f6ef7c5d0 }
+    }
+  }, {
+    {
+      { 0xe1b7f29362730383, 0x4b5279ffebca8a2c,
+        0xdafc778abfd41314, 0x7deb10149c72610f },
+      { 0x51f048478f387475, 0xb25dbcf49cbecb3c,
+        0x9aab1244d99f2055, 0x2c709e6c1c10a5d6 },
+      { 0xcb62af6a8766ee7a, 0x66cbec045553cd0e,
+        0x588001380f0be4b5, 0x08e68e9ff62ce2ea }
+    }, {
+      { 0x2f2d09d50ab8f2f9, 0xacb9218dc55923df,
+        0x4a8f342673766cb9, 0x4cb13bd738f719f5 },
+      { 0x34ad500a4bc130ad, 0x8d38db493d0bd49c,
+        0xa25c3d98500a89be, 0x2f1f3f87eeba3b09 },
+      { 0xf7848c75e515b64a, 0xa59501badb4a9038,
+        0xc20d313f3f751b50, 0x19a1e353c0ae2ee8 }
+    }, {
+      { 0xb42172cdd596bdbd, 0x93e0454398eefc40,
+        0x9fb15347b44109b5, 0x736bd3990266ae34 },
+      { 0x7d1c7560bafa05c3, 0xb3e1a0a0c6e55e61,
+        0xe3529718c0d66473, 0x41546b11c20c3486 },
+      { 0x85532d509334b3b4, 0x46fd114b60816573,
+        0xcc5f5f30425c8375, 0x412295a2b87fab5c }
+    }, {
+      { 0x2e655261e293eac6, 0x845a92032133acdb,
+        0x460975cb7900996b, 0x0760bb8d195add80 },
+      { 0x19c99b88f57ed6e9, 0x5393cb266df8c825,
+        0x5cee3213b30ad273, 0x14e153ebb52d2e34 },
+      { 0x413e1a17cde6818a, 0x57156da9ed69a084,
+        0x2cbf268f46caccb1, 0x6b34be9bc33ac5f2 }
+    }, {
+      { 0x11fc69656571f2d3, 0xc6c9e845530e737a,
+        0xe33ae7a2d4fe5035, 0x01b9c7b62e6dd30b },
+      { 0xf3df2f643a78c0b2, 0x4c3e971ef22e027c,
+        0xec7d1c5e49c1b5a3, 0x2012c18f0922dd2d },
+      { 0x880b55e55ac89d29, 0x1483241f45a0a763,
+        0x3d36efdfc2e76c1f, 0x08af5b784e4bade8 }
+    }, {
+      { 0xe27314d289cc2c4b, 0x4be4bd11a287178d,
+        0x18d528d6fa3364ce, 0x6423c1d5afd9826e },
+      { 0x283499dc881f2533, 0x9d0525da779323b6,
+        0x897addfb673441f4, 0x32b79d71163a168d },
+      { 0xcc85f8d9edfcb36a, 0x22bcc28f3746e5f9,
+        0xe49de338f9e5d3cd, 0x480a5efbc13e2dcc }
+    }, {
+      { 0xb6614ce442ce221f, 0x6e199dcc4c053928,
+        0x663fb4a4dc1cbe03, 0x24b31d47691c8e06 },
+      { 0x0b51e70b01622071, 0x06b505cf8b1dafc5,
+        0x2c6bb061ef5aabcd, 0x47aa27600cb7bf31 },
+      { 0x2a541eedc015f8c3, 0x11a4fe7e7c693f7c,
+        0xf0af66134ea278d6, 0x545b585d14dda094 }
+    }, {
+      { 0x6204e4d0e3b321e1, 0x3baa637a28ff1e95,
+        0x0b0ccffd5b99bd9e, 0x4d22dc3e64c8d071 },
+      { 0x67bf275ea0d43a0f, 0xade68e34089beebe,
+        0x4289134cd479e72e, 0x0f62f9c332ba5454 },
+      { 0xfcb46589d63b5f39, 0x5cae6a3f57cbcf61,
+        0xfebac2d2953afa05, 0x1c0fa01a36371436 }
+    }
+  }
+};
+
+static void cmov(element_t out, const element_t x, limb_t mask) {
+  for (int i = 0; i < terms; i++)
+    out[i] ^= (out[i] ^ x[i]) & mask;
+}
+
+static void extend(element_t p[4]) {
+  element_t x, y;
+  mul(x, p[0], p[3]);
+  mul(y, p[1], p[2]);
+  mul(p[2], p[2], p[3]);
+  mul(p[3], p[0], p[1]);
+  memcpy(p[0], x, sizeof(element_t));
+  memcpy(p[1], y, sizeof(element_t));
+}
+
+static void dbl(element_t p[4], int n) {
+  element_t a, b, c, d;
+  for (int i = 0; i < n; i++) {
+    sqr(a, p[0]);
+    sqr(b, p[1]);
+    sqr(c, p[2]);
+    add(c, c, c);
+    add(d, p[0], p[1]);
+    sqr(d, d);
+
+    add(p[1], b, a);
+    sub(p[2], b, a);
+    sub(p[0], d, p[1]);
+    sub(p[3], c, p[2]);
+
+    /* Only the final doubling needs the extended coordinate */
+    if (i + 1 == n) {
+      extend(p);
+    } else {
+      mul(p[0], p[0], p[3]);
+      mul(p[1], p[1], p[2]);
+      mul(p[2], p[2], p[3]);
+    }
+  }
+}
+
+static void madd(element_t p[4], const element_t q[3]) {
+  element_t a, b, c, d;
+  sub(a, p[1], p[0]);
+  mul(a, a, q[1]);
+  add(b, p[1], p[0]);
+  mul(b, b, q[0]);
+  mul(c, p[3], q[2]);
+  add(d, p[2], p[2]);
+
+  sub(p[0], b, a);
+  add(p[1], b, a);
+  add(p[2], d, c);
+  sub(p[3], d, c);
+  extend(p);
+}
+
+static void padd(element_t p[4], const element_t q[4]) {
+  element_t a, b, c, d;
+  sub(a, p[1], p[0]);
+  sub(b, q[1], q[0]);
+  mul(a, a, b);
+  add(b, p[1], p[0]);
+  add(c, q[1], q[0]);
+  mul(b, b, c);
+  mul(c, p[3], q[3]);
+  mul(c, c, edwards_d);
+  add(c, c, c);
+  mul(d, p[2], q[2]);
+  add(d, d, d);
+
+  sub(p[0], b, a);
+  add(p[1], b, a);
+  add(p[2], d, c);
+  sub(p[3], d, c);
+  extend(p);
+}
+
+static void lookup(element_t q[3], const uint64_t row[8][3][4],
+    int8_t digit) {
+  limb_t negative = -(limb_t) ((uint8_t) digit >> 7);
+  uint8_t magnitude = (digit ^ negative) - negative;
+
+  memcpy(q[0], one, sizeof(element_t));
+  memcpy(q[1], one, sizeof(element_t));
+  memcpy(q[2], zero, sizeof(element_t));
+  for (int i = 0; i < 8; i++) {
+    limb_t mask = ((limb_t) (magnitude ^ (i + 1)) - 1) >> (width - 1);
+    for (int j = 0; j < 3; j++) {
+      element_t entry;
+      load(entry, row[i][j]);
+      cmov(q[j], entry, -mask);
+    }
+  }
+
+  element_t t;
+  sub(t, zero, q[2]);
+  condswap(q[0], q[1], negative);
+  cmov(q[2], t, negative);
+}
+
+static void fetch(element_t q[3], const uint64_t row[8][3][4],
+    int8_t digit) {
+  for (int j = 0; j < 3; j++)
+    load(q[j], row[(digit < 0 ? -digit : digit) - 1][j]);
+  if (digit < 0) {
+    condswap(q[0], q[1], -1);
+    sub(q[2], zero, q[2]);
+  }
+}
+
+static void recode(int8_t digit[65], const x25519_t scalar) {
+  int8_t carry = 0;
+  for (int i = 0; i < 32; i++) {
+    digit[2 * i] = scalar[i] & 15;
+    digit[2 * i + 1] = scalar[i] >> 4;
+  }
+  for (int i = 0; i < 64; i++) {
+    digit[i] += carry;
+    carry = (digit[i] + 8) >> 4;
+    digit[i] -= carry << 4;
+  }
+  digit[64] = carry;
+}
+
+static void comb(element_t x, element_t z, const uint64_t table[][8][3][4],
+    int rows, const int8_t digit[65], int vartime) {
+  element_t p[4], q[3];
+
+  memcpy(p[0], zero, sizeof(element_t));
+  memcpy(p[1], one, sizeof(element_t));
+  memcpy(p[2], one, sizeof(element_t));
+  memcpy(p[3], zero, sizeof(element_t));
+
+  for (int i = spacing - 1; i >= 0; i--) {
+    if (i < spacing - 1)
+      dbl(p, 4);
+    for (int j = 0; j < rows && j * spacing + i < 65; j++) {
+      if (vartime == 0)
+        lookup(q, table[j], digit[j * spacing + i]), madd(p, q);
+      else if (digit[j * spacing + i] != 0)
+        fetch(q, table[j], digit[j * spacing + i]), madd(p, q);
+    }
+  }
+
+  add(x, p[2], p[1]);
+  sub(z, p[2], p[1]);
+}
+
+static void x25519_comb(element_t x, element_t z, const x25519_t scalar,
+    int vartime) {
+  int8_t digit[65];
+  scalar_t k;
+  x25519_t bytes;
+
+  get(k, scalar);
+  montmul(k, k, scalar_r2);
+  montmul(k, k, one);
+  put(bytes, k);
+
+  recode(digit, bytes);
+  comb(x, z, niels, combs, digit, vartime);
+}
+
+static void x25519_combs(element_t x, element_t z, const x25519_t scalar,
+    const x25519_prepared_t *prepared, int vartime) {
+  int8_t digit[65];
+
+  if (prepared->ladder) {
+    x25519_core(x, z, scalar, prepared->point);
+  } else {
+    recode(digit, scalar);
+    comb(x, z, prepared->comb, combs + 1, digit, vartime);
+  }
+}
+
+static limb_t edwards(element_t p[4], const x25519_t point) {
+  element_t r, s, u, v;
+
+  /* Projective y = (u - 1) / (u + 1) with a matching x = sqrt(v / r) */
+  unpack(u, point);
+  add(p[2], u, one);
+  sub(p[1], u, one);
+  sqr(r, p[1]);
+  sqr(s, p[2]);
+  sub(v, r, s);
+  mul(r, r, edwards_d);
+  add(r, r, s);
+  mul(s, v, r);
+  limb_t mask = invsqrt(s, s);
+  mul(u, v, s);
+  mul(p[0], u, p[2]);
+  mul(p[3], u, p[1]);
+  return canon(p[2]) | mask;
+}
+
+static void slide(int8_t digit[257], const x25519_t scalar) {
+  for (int i = 0; i < 257; i++)
+    digit[i] = i < 256 ? scalar[i >> 3] >> (i & 7) & 1 : 0;
+
+  /* Merge set bits into odd signed digits below 16 in magnitude */
+  for (int i = 0; i < 257; i++) {
+    for (int j = 1; digit[i] != 0 && j < 5 && i + j < 257; j++) {
+      if (digit[i + j] == 0)
+        continue;
+      if (digit[i] + (digit[i + j] << j) < 16) {
+        digit[i] += digit[i + j] << j;
+        digit[i + j] = 0;
+      } else if (digit[i] - (digit[i + j] << j) > -16) {
+        digit[i] -= digit[i + j] << j;
+        for (int k = i + j; k < 257; k++) {
+          digit[k] = !digit[k];
+          if (digit[k])
+            break;
+        }
+      } else {
+        break;
+      }
+    }
+  }
+}
+
+static void x25519_wnaf(element_t x, element_t z, const x25519_t scalar,
+    const x25519_t point) {
+  element_t p[4], q[8][4], t[4];
+  int8_t digit[257];
+  int i = 256, n = 0;
+
+  /* Twist points, zero and u = -1 have no Edwards image to work with */
+  if (edwards(q[0], point)) {
+    x25519_core(x, z, scalar, point);
+    return;
+  }
+
+  memcpy(t, q[0], sizeof(t));
+  dbl(t, 1);
+  for (int j = 1; j < 8; j++) {
+    memcpy(q[j], q[j - 1], sizeof(t));
+    padd(q[j], t);
+  }
+
+  memcpy(p[0], zero, sizeof(element_t));
+  memcpy(p[1], one, sizeof(element_t));
+  memcpy(p[2], one, sizeof(element_t));
+  memcpy(p[3], zero, sizeof(element_t));
+
+  slide(digit, scalar);
+  for (i = 256; i > 0 && digit[i] == 0; i--);
+  for (; i >= 0; i--, n++) {
+    if (digit[i] == 0)
+      continue;
+    dbl(p, n), n = 0;
+    memcpy(t, q[(digit[i] < 0 ? -digit[i] : digit[i]) >> 1], sizeof(t));
+    if (digit[i] < 0) {
+      sub(t[0], zero, t[0]);
+      sub(t[3], zero, t[3]);
+    }
+    padd(p, t);
+  }
+  dbl(p, n - 1);
+
+  add(x, p[2], p[1]);
+  sub(z, p[2], p[1]);
+}
+
+static void split(slimb_t out[digits], const uint64_t in[4]) {
+  for (int i = 0, bit = 0; i < digits; i++, bit += steps) {
+    uint64_t value = bit < 256 ? in[bit / 64] >> bit % 64 : 0;
+    if (bit % 64 > 64 - steps && bit / 64 < 3)
+      value |= in[bit / 64 + 1] << (64 - bit % 64);
+    out[i] = value & ((limb_t) -1 >> 2);
+  }
+}
+
+static void join(uint64_t out[4], const slimb_t in[digits]) {
+  memset(out, 0, 4 * sizeof(uint64_t));
+  for (int i = 0, bit = 0; i < digits; i++, bit += steps) {
+    out[bit / 64] |= (uint64_t) in[i] << bit % 64;
+    if (bit % 64 > 64 - steps && bit / 64 < 3)
+      out[bit / 64 + 1] |= (uint64_t) in[i] >> (64 - bit % 64);
+  }
+}
+
+static slimb_t divsteps(slimb_t zeta, limb_t f, limb_t g, slimb_t t[4]) {
+  limb_t u = 1, v = 0, q = 0, r = 1;
+
+  for (int i = 0; i < steps; i++) {
+    limb_t swap = zeta >> (width - 1), odd = -(g & 1);
+    g += ((f ^ swap) - swap) & odd;
+    q += ((u ^ swap) - swap) & odd;
+    r += ((v ^ swap) - swap) & odd;
+    swap &= odd;
+    zeta = (zeta ^ (slimb_t) swap) - 1;
+    f += g & swap, u += q & swap, v += r & swap;
+    g >>= 1, u <<= 1, v <<= 1;
+  }
+
+  t[0] = u, t[1] = v, t[2] = q, t[3] = r;
+  return zeta;
+}
+
+static void transform(slimb_t x[digits], slimb_t y[digits],
+    const slimb_t t[4], const slimb_t modulus[digits], limb_t inverse) {
+  const limb_t mask = (limb_t) -1 >> 2;
+  sdlimb_t cx = 0, cy = 0;
+  slimb_t mx = 0, my = 0;
+
+  /* Add multiples of the modulus to make the low digit divisible */
+  if (modulus) {
+    slimb_t sx = x[digits - 1] >> (width - 1);
+    slimb_t sy = y[digits - 1] >> (width - 1);
+    mx = (t[0] & sx) + (t[1] & sy);
+    my = (t[2] & sx) + (t[3] & sy);
+  }
+
+  for (int i = 0; i < digits; i++) {
+    cx += (sdlimb_t) t[0] * x[i] + (sdlimb_t) t[1] * y[i];
+    cy += (sdlimb_t) t[2] * x[i] + (sdlimb_t) t[3] * y[i];
+    if (modulus && i == 0) {
+      mx -= (inverse * (limb_t) cx + mx) & mask;
+      my -= (inverse * (limb_t) cy + my) & mask;
+    }
+    if (modulus) {
+      cx += (sdlimb_t) modulus[i] * mx;
+      cy += (sdlimb_t) modulus[i] * my;
+    }
+    if (i > 0)
+      x[i - 1] = cx & mask, y[i - 1] = cy & mask;
+    cx >>= steps, cy >>= steps;
+  }
+  x[digits - 1] = cx, y[digits - 1] = cy;
+}
+
+static void normalise(slimb_t x[digits], slimb_t sign,
+    const slimb_t modulus[digits]) {
+  slimb_t add = x[digits - 1] >> (width - 1);
+  sign >>= width - 1;
+
+  for (int k = 0; k < 2; k++) {
+    for (int i = 0; i < digits; i++) {
+      x[i] += modulus[i] & add;
+      if (k == 0)
+        x[i] = (x[i] ^ sign) - sign;
+    }
+    for (int i = 0; i + 1 < digits; i++) {
+      x[i + 1] += x[i] >> steps;
+      x[i] &= (limb_t) -1 >> 2;
+    }
+    add = x[digits - 1] >> (width - 1);
+  }
+}
+
+static void safegcd(uint64_t out[4], const uint64_t in[4],
+    const uint64_t modulus[4]) {
+  slimb_t d[digits] = { 0 }, e[digits] = { 1 }, f[digits], g[digits];
+  slimb_t m[digits], t[4], zeta = -1;
+
+  split(m, modulus);
+  split(f, modulus);
+  split(g, in);
+
+  limb_t inverse = m[0];
+  for (int i = 0; i < 5; i++)
+    inverse *= 2 - m[0] * inverse;
+
+  /* 590 divsteps are enough for any pair of 256-bit inputs */
+  for (int i = 0; i < (590 + steps - 1) / steps; i++) {
+    zeta = divsteps(zeta, f[0], g[0], t);
+    transform(d, e, t, m, inverse);
+    transform(f, g, t, 0, 0);
+  }
+
+  normalise(d, f[digits - 1], m);
+  join(out, d);
+}
+
+static void invert(element_t out, const element_t z) {
+  const uint64_t prime[4] = {
+    0xffffffffffffffed, 0xffffffffffffffff,
+    0xffffffffffffffff, 0x7fffffffffffffff
+  };
+
+  uint64_t words[4];
+  memcpy(out, z, sizeof(element_t));
+  canon(out);
+  store(words, out);
+  safegcd(words, words, prime);
+  load(out, words);
+}
+
+static limb_t project(x25519_t out, element_t x, const element_t z) {
+  element_t t;
+  invert(t, z);
   mul(x, x, t);
 
   limb_t result = canon(x);
-  put(out, x);
+  pack(out, x);
   return result;
 }
 
-void x25519_invert(x25519_t out, const x25519_t scalar) {
-  scalar_t x, y, z[8];
-  get(x, scalar);
+static void reciprocal(scalar_t out, const scalar_t x) {
+  const uint64_t order[4] = {
+    0x5812631a5cf5d3ed, 0x14def9dea2f79cd6,
+    0x0000000000000000, 0x1000000000000000
+  };
+
+  uint64_t words[4] = { 0 };
+  for (int i = 0; i < limbs; i++)
+    words[i * width / 64] |= (uint64_t) x[i] << i * width % 64;
+  safegcd(words, words, order);
+  for (int i = 0; i < limbs; i++)
+    out[i] = words[i * width / 64] >> i * width % 64;
+}
 
-  montmul(z[0], x, scalar_r2);
-  montmul(z[7], z[0], z[0]);
-  for (int i = 0; i < 7; i++)
-    montmul(z[i + 1], z[i], z[7]);
-  memcpy(y, z[0], sizeof(scalar_t));
+static void cofactor(scalar_t x) {
+  const scalar_t k = {
+    limb(0x6106e529e2dc2f79), limb(0x07d39db37d1cdad0),
+    limb(0x0000000000000000), limb(0x0600000000000000)
+  };
+
+  montmul(x, x, k);
+  montmul(x, x, scalar_r2);
 
-  uint8_t residue = 0, trailing = 0;
-  for (int i = 248; i >= -3; i--) {
-    limb_t limb = i < 0 ? 0 : scalar_l[i / width] - (i < width ? 2 : 0);
-    residue = residue << 1 | (limb >> (i % width) & 1);
-    montmul(y, y, y);
-    if (residue >> 3 != 0)
-      trailing = residue, residue = 0;
-    if (trailing > 0 && (trailing & 7) == 0)
-      montmul(y, y, z[trailing >> 4]), trailing = 0;
-    trailing <<= 1;
+  dlimb_t carry = 0;
+  for (int i = 0; i < limbs; i++)
+    x[i] = carry += (dlimb_t) x[i] << 3, carry >>= width;
+}
+
+static void reciprocals(scalar_t out[], const x25519_t scalar[],
+    size_t count) {
+  scalar_t product[batch], r, t, u;
+  limb_t mask[batch];
+
+  /* Work in the Montgomery domain, where R mod l represents one */
+  montmul(r, one, scalar_r2);
+  memcpy(t, r, sizeof(scalar_t));
+  for (size_t i = 0; i < count; i++) {
+    limb_t bits = 0;
+    get(out[i], scalar[i]);
+    montmul(out[i], out[i], scalar_r2);
+    for (int k = 0; k < limbs; k++)
+      bits |= out[i][k];
+
+    /* Substitute one for a zero scalar to keep the chain invertible */
+    mask[i] = ((dlimb_t) bits - 1) >> width;
+    for (int k = 0; k < limbs; k++)
+      out[i][k] ^= (out[i][k] ^ r[k]) & mask[i];
+    memcpy(product[i], t, sizeof(scalar_t));
+    montmul(t, t, out[i]);
   }
 
-  montmla(y, zero, zero);
-  put(out, y);
+  montmla(t, zero, zero);
+  reciprocal(u, t);
+  montmul(u, u, scalar_r2);
+
+  for (size_t i = count; i-- > 0;) {
+    montmul(t, u, product[i]);
+    montmul(u, u, out[i]);
+    montmla(t, zero, zero);
+    for (int k = 0; k < limbs; k++)
+      out[i][k] = t[k] & ~mask[i];
+  }
 }
 
-void x25519_point(x25519_t out, const x25519_t element) {
+static int projects(x25519_t out[], element_t x[], element_t z[],
+    int result[], size_t count) {
+  element_t product[batch], t, u;
+  int failed = 0;
+
+  memcpy(t, one, sizeof(element_t));
+  for (size_t i = 0; i < count; i++) {
+    /* A vanishing product has z = 0: substitute 0 / 1 to keep the chain */
+    limb_t mask = canon(z[i]);
+    cmov(x[i], zero, mask);
+    cmov(z[i], one, mask);
+    memcpy(product[i], t, sizeof(element_t));
+    mul(t, t, z[i]);
+  }
+
+  invert(u, t);
+  for (size_t i = count; i-- > 0;) {
+    mul(t, u, product[i]);
+    mul(u, u, z[i]);
+    mul(x[i], x[i], t);
+
+    int check = canon(x[i]);
+    pack(out[i], x[i]);
+    if (result)
+      result[i] = check;
+    failed |= check;
+  }
+  return failed;
+}
+
+static void elligator(x25519_t out, const x25519_t element) {
   const limb_t a = 486662;
   const element_t k = {
-    limb(0x7623c9b16be2be8d), limb(0xa179cff2a5a0370e),
-    limb(0xa965fecd840850b1), limb(0x28f9b6ff607c41e9)
+    element(0x7623c9b16be2be8d, 0xa179cff2a5a0370e,
+      0xa965fecd840850b1, 0x28f9b6ff607c41e9)
   };
 
   element_t r, s, x, y, z;
-  get(r, element);
+  unpack(r, element);
 
-  mul(s, r, r);
+  sqr(s, r);
   add(s, s, s);
   add(x, s, one);
-  mul(y, x, x);
+  sqr(y, x);
   mul1(z, s, a);
   mul1(z, z, a);
   sub(z, z, y);
@@ -338,23 +2323,235 @@ void x25519_point(x25519_t out, const x25519_t element) {
   condswap(x, s, mask);
 
   canon(x);
-  put(out, x);
+  pack(out, x);
 }
 
-void x25519_scalar(x25519_t out, const x25519_t scalar) {
-  const scalar_t k = {
-    limb(0x6106e529e2dc2f79), limb(0x07d39db37d1cdad0),
-    limb(0x0000000000000000), limb(0x0600000000000000)
-  };
+static int multiply(x25519_t out[], const x25519_t scalar[],
+    const x25519_t point[], int result[], size_t count) {
+  element_t x[batch], z[batch];
+  size_t i = 0;
+
+#ifdef LADDERS
+  for (; avx512 && i < count; i += LADDERS) {
+    size_t lanes = count - i < LADDERS ? count - i : LADDERS;
+    x25519_ladders(x + i, z + i, scalar + i, point + i, lanes);
+  }
+#endif
+  for (; i < count; i++)
+    x25519_core(x[i], z[i], scalar[i], point[i]);
+
+  return projects(out, x, z, result, count);
+}
+
+static int verify(element_t x1, element_t z1, element_t x2, element_t z2,
+    const x25519_t ephemeral) {
+  element_t x3, z3, t1;
+
+  memcpy(x3, x1, sizeof(element_t));
+  memcpy(z3, z1, sizeof(element_t));
+  ladder1(x2, z2, x3, z3, t1);
+  mul(z2, z2, x1);
+  mul(z2, z2, z1);
+
+  unpack(t1, ephemeral);
+  mul(z2, z2, t1);
+  mul1(z2, z2, 16);
+
+  mul(z3, z3, t1);
+  sub(z3, z3, x3);
+  sqr(z3, z3);
+
+  sub(z3, z3, z2);
+  return canon(z2) | ~canon(z3);
+}
+
+int x25519(x25519_t out, const x25519_t scalar,
+    const x25519_t point) {
+  element_t x, z;
+  x25519_core(x, z, scalar, point);
+  return project(out, x, z);
+}
+
+int x25519_public(x25519_t out, const x25519_t scalar) {
+  element_t x, z;
+  x25519_comb(x, z, scalar, 0);
+  return project(out, x, z);
+}
+
+int x25519_batch(x25519_t out[], const x25519_t scalar[],
+    const x25519_t point[], int result[], size_t count) {
+  int failed = 0;
+
+  for (size_t i = 0; i < count; i += batch) {
+    size_t size = count - i < batch ? count - i : batch;
+    failed |= multiply(out + i, scalar + i, point + i,
+      result ? result + i : 0, size);
+  }
+  return failed;
+}
+
+int x25519_public_batch(x25519_t out[], const x25519_t scalar[],
+    int result[], size_t count) {
+  element_t x[batch], z[batch];
+  int failed = 0;
+
+  for (size_t i = 0; i < count; i += batch) {
+    size_t size = count - i < batch ? count - i : batch;
+    for (size_t j = 0; j < size; j++)
+      x25519_comb(x[j], z[j], scalar[i + j], 0);
+    failed |= projects(out + i, x, z, result ? result + i : 0, size);
+  }
+  return failed;
+}
+
+void x25519_prepare(x25519_prepared_t *prepared,
+    const x25519_t point) {
+  element_t p[4], q[4], r, s, t, u, v;
+  element_t product[8 * (combs + 1)];
+
+  memcpy(prepared->point, point, sizeof(x25519_t));
+  unpack(u, point);
+
+  /* Map to Edwards y = (u - 1) / (u + 1) and recover a matching x */
+  add(t, u, one);
+  invert(s, t);
+  sub(p[1], u, one);
+  mul(p[1], p[1], s);
+  sqr(r, p[1]);
+  sub(v, r, one);
+  mul(r, r, edwards_d);
+  add(r, r, one);
+  mul(s, v, r);
+  limb_t mask = invsqrt(s, s);
+  mul(p[0], v, s);
+
+  /* Twist points, zero and u = -1 have no Edwards image to tabulate */
+  prepared->ladder = (canon(t) | mask) != 0;
+  if (prepared->ladder)
+    return;
+
+  memcpy(p[2], one, sizeof(element_t));
+  mul(p[3], p[0], p[1]);
+
+  for (int i = 0; i <= combs; i++) {
+    memcpy(q, p, sizeof(q));
+    for (int j = 0; j < 8; j++) {
+      if (j > 0)
+        padd(q, p);
+      for (int k = 0; k < 3; k++)
+        store(prepared->comb[i][j][k], q[k]);
+    }
+    if (i < combs)
+      dbl(p, 4 * spacing);
+  }
+
+  /* Normalise every entry together with a single inversion */
+  memcpy(t, one, sizeof(element_t));
+  for (int i = 0; i < 8 * (combs + 1); i++) {
+    memcpy(product[i], t, sizeof(element_t));
+    load(s, prepared->comb[i >> 3][i & 7][2]);
+    mul(t, t, s);
+  }
+  invert(u, t);
+
+  for (int i = 8 * (combs + 1) - 1; i >= 0; i--) {
+    uint64_t (*entry)[4] = prepared->comb[i >> 3][i & 7];
+    mul(t, u, product[i]);
+    load(s, entry[2]);
+    mul(u, u, s);
+
+    load(r, entry[0]);
+    load(s, entry[1]);
+    mul(r, r, t);
+    mul(s, s, t);
+    mul(v, r, s);
+    mul(v, v, edwards_d);
+    add(v, v, v);
+    add(t, s, r);
+    sub(s, s, r);
+    store(entry[0], t);
+    store(entry[1], s);
+    store(entry[2], v);
+  }
+}
 
+int x25519_prepared(x25519_t out, const x25519_t scalar,
+    const x25519_prepared_t *prepared) {
+  element_t x, z;
+  x25519_combs(x, z, scalar, prepared, 0);
+  return project(out, x, z);
+}
+
+int x25519_prepared_vartime(x25519_t out, const x25519_t scalar,
+    const x25519_prepared_t *prepared) {
+  element_t x, z;
+  x25519_combs(x, z, scalar, prepared, 1);
+  return project(out, x, z);
+}
+
+void x25519_invert(x25519_t out, const x25519_t scalar) {
   scalar_t x;
   get(x, scalar);
-  montmul(x, x, k);
   montmul(x, x, scalar_r2);
+  montmla(x, zero, zero);
+  reciprocal(x, x);
+  put(out, x);
+}
 
-  dlimb_t carry = 0;
-  for (int i = 0; i < limbs; i++)
-    x[i] = carry += (dlimb_t) x[i] << 3, carry >>= width;
+void x25519_invert_batch(x25519_t out[], const x25519_t scalar[],
+    size_t count) {
+  scalar_t x[batch];
+
+  for (size_t i = 0; i < count; i += batch) {
+    size_t size = count - i < batch ? count - i : batch;
+    reciprocals(x, scalar + i, size);
+    for (size_t j = 0; j < size; j++)
+      put(out[i + j], x[j]);
+  }
+}
+
+void x25519_point(x25519_t out, const x25519_t element) {
+  elligator(out, element);
+}
+
+int x25519_blind_batch(x25519_t out[], const x25519_t blind[],
+    const x25519_t element[], int result[], size_t count) {
+  x25519_t point[batch];
+  int failed = 0;
+
+  for (size_t i = 0; i < count; i += batch) {
+    size_t size = count - i < batch ? count - i : batch;
+    for (size_t j = 0; j < size; j++)
+      elligator(point[j], element[i + j]);
+    failed |= multiply(out + i, blind + i, point,
+      result ? result + i : 0, size);
+  }
+  return failed;
+}
+
+int x25519_unblind_batch(x25519_t out[], const x25519_t blind[],
+    const x25519_t point[], int result[], size_t count) {
+  x25519_t scalar[batch];
+  scalar_t x[batch];
+  int failed = 0;
+
+  for (size_t i = 0; i < count; i += batch) {
+    size_t size = count - i < batch ? count - i : batch;
+    reciprocals(x, blind + i, size);
+    for (size_t j = 0; j < size; j++) {
+      cofactor(x[j]);
+      put(scalar[j], x[j]);
+    }
+    failed |= multiply(out + i, scalar, point + i,
+      result ? result + i : 0, size);
+  }
+  return failed;
+}
+
+void x25519_scalar(x25519_t out, const x25519_t scalar) {
+  scalar_t x;
+  get(x, scalar);
+  cofactor(x);
   put(out, x);
 }
 
@@ -370,26 +2567,50 @@ void x25519_sign(x25519_t response, const x25519_t challenge,
   put(response, y);
 }
 
-int x25519_verify(const x25519_t response, const x25519_t challenge,
-    const x25519_t ephemeral, const x25519_t identity) {
-  element_t x1, z1, x2, z2, x3, z3, t1;
-  x25519_core(x1, z1, challenge, identity);
-  x25519_core(x2, z2, response, x25519_base);
+int x25519_verify(const x25519_t response,
+    const x25519_t challenge, const x25519_t ephemeral,
+    const x25519_t identity) {
+  element_t x1, z1, x2, z2;
+  x25519_wnaf(x1, z1, challenge, identity);
+  x25519_comb(x2, z2, response, 1);
+  return verify(x1, z1, x2, z2, ephemeral);
+}
 
-  memcpy(x3, x1, sizeof(element_t));
-  memcpy(z3, z1, sizeof(element_t));
-  ladder1(x2, z2, x3, z3, t1);
-  mul(z2, z2, x1);
-  mul(z2, z2, z1);
+int x25519_verify_prepared(const x25519_t response,
+    const x25519_t challenge, const x25519_t ephemeral,
+    const x25519_prepared_t *identity) {
+  element_t x1, z1, x2, z2;
+  x25519_combs(x1, z1, challenge, identity, 1);
+  x25519_comb(x2, z2, response, 1);
+  return verify(x1, z1, x2, z2, ephemeral);
+}
 
-  get(t1, ephemeral);
-  mul(z2, z2, t1);
-  mul1(z2, z2, 16);
+int x25519_verify_batch(const x25519_t response[],
+    const x25519_t challenge[], const x25519_t ephemeral[],
+    const x25519_t identity[], int result[], size_t count) {
+  element_t x1[batch], z1[batch], x2, z2;
+  int failed = 0;
 
-  mul(z3, z3, t1);
-  sub(z3, z3, x3);
-  mul(z3, z3, z3);
+  for (size_t i = 0; i < count; i += batch) {
+    size_t size = count - i < batch ? count - i : batch, j = 0;
 
-  sub(z3, z3, z2);
-  return canon(z2) | ~canon(z3);
+#ifdef LADDERS
+    for (; avx512 && j < size; j += LADDERS) {
+      size_t lanes = size - j < LADDERS ? size - j : LADDERS;
+      x25519_ladders(x1 + j, z1 + j, challenge + i + j, identity + i + j,
+        lanes);
+    }
+#endif
+    for (; j < size; j++)
+      x25519_wnaf(x1[j], z1[j], challenge[i + j], identity[i + j]);
+
+    for (size_t j = 0; j < size; j++) {
+      x25519_comb(x2, z2, response[i + j], 1);
+      int check = verify(x1[j], z1[j], x2, z2, ephemeral[i + j]);
+      if (result)
+        result[i + j] = check;
+      failed |= check;
+    }
+  }
+  return failed;
 }
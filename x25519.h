@@ -3,6 +3,7 @@
 #ifndef X25519_H
 #define X25519_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 enum { x25519_size = 32 };
@@ -10,12 +11,43 @@ typedef uint8_t x25519_t[x25519_size];
 
 extern const x25519_t x25519_base;
 
+typedef struct {
+  uint64_t comb[17][8][3][4];
+  x25519_t point;
+  int ladder;
+} x25519_prepared_t;
+
 int x25519(x25519_t out, const x25519_t scalar, const x25519_t point);
 
+int x25519_public(x25519_t out, const x25519_t scalar);
+
+int x25519_batch(x25519_t out[], const x25519_t scalar[],
+  const x25519_t point[], int result[], size_t count);
+
+int x25519_public_batch(x25519_t out[], const x25519_t scalar[],
+  int result[], size_t count);
+
+void x25519_prepare(x25519_prepared_t *prepared, const x25519_t point);
+
+int x25519_prepared(x25519_t out, const x25519_t scalar,
+  const x25519_prepared_t *prepared);
+
+int x25519_prepared_vartime(x25519_t out, const x25519_t scalar,
+  const x25519_prepared_t *prepared);
+
 void x25519_invert(x25519_t out, const x25519_t scalar);
 
+void x25519_invert_batch(x25519_t out[], const x25519_t scalar[],
+  size_t count);
+
 void x25519_point(x25519_t out, const x25519_t element);
 
+int x25519_blind_batch(x25519_t out[], const x25519_t blind[],
+  const x25519_t element[], int result[], size_t count);
+
+int x25519_unblind_batch(x25519_t out[], const x25519_t blind[],
+  const x25519_t point[], int result[], size_t count);
+
 void x25519_scalar(x25519_t out, const x25519_t scalar);
 
 void x25519_sign(x25519_t response, const x25519_t challenge,
@@ -24,4 +56,12 @@ void x25519_sign(x25519_t response, const x25519_t challenge,
 int x25519_verify(const x25519_t response, const x25519_t challenge,
   const x25519_t ephemeral, const x25519_t identity);
 
+int x25519_verify_prepared(const x25519_t response,
+  const x25519_t challenge, const x25519_t ephemeral,
+  const x25519_prepared_t *identity);
+
+int x25519_verify_batch(const x25519_t response[],
+  const x25519_t challenge[], const x25519_t ephemeral[],
+  const x25519_t identity[], int result[], size_t count);
+
 #endif
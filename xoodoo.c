@@ -0,0 +1,65 @@
+/* xoodoo.c from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined DISPATCH && defined __x86_64__ && defined __GLIBC__
+#define dispatch __attribute__((flatten, target_clones("default", \
+  "arch=x86-64-v3", "arch=x86-64-v4")))
+#define duplex_lanes 16
+#define duplex_dispatch
+#else
+#define dispatch
+#endif
+
+#define duplex_permute duplex_xoodoo
+#include "duplex.h"
+#include "lanes.h"
+#include "tree.h"
+
+dispatch void xoodoo_permute(uint32x4_t state[3]) {
+  duplex_xoodoo(state);
+}
+
+dispatch void xoodoo_permute_many(uint32x4_t *state[], size_t count) {
+  duplex_permute_many(state, count);
+}
+
+dispatch void xoodoo_absorb(duplex_t state, const void *data,
+    size_t length) {
+  duplex_absorb(state, data, length);
+}
+
+dispatch void xoodoo_decrypt(duplex_t state, void *data, size_t length) {
+  duplex_decrypt(state, data, length);
+}
+
+dispatch void xoodoo_encrypt(duplex_t state, void *data, size_t length) {
+  duplex_encrypt(state, data, length);
+}
+
+dispatch void xoodoo_pad(duplex_t state) {
+  duplex_pad(state);
+}
+
+dispatch void xoodoo_ratchet(duplex_t state) {
+  duplex_ratchet(state);
+}
+
+dispatch void xoodoo_squeeze(duplex_t state, void *data, size_t length) {
+  duplex_squeeze(state, data, length);
+}
+
+dispatch int xoodoo_open_many(uint32x4_t *state[], uint8_t *const data[],
+    const size_t length[], int result[], size_t count) {
+  return duplex_open_many(state, data, length, result, count);
+}
+
+dispatch void xoodoo_seal_many(uint32x4_t *state[], uint8_t *const data[],
+    const size_t length[], size_t count) {
+  duplex_seal_many(state, data, length, count);
+}
+
+dispatch void xoodoo_tree(duplex_t state, const void *data, size_t length) {
+  duplex_tree(state, data, length);
+}
@@ -0,0 +1,34 @@
+/* xoodoo.h from Pocketcrypt: https://github.com/arachsys/pocketcrypt */
+
+#ifndef XOODOO_H
+#define XOODOO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duplex.h"
+
+void xoodoo_permute(uint32x4_t state[3]);
+
+void xoodoo_permute_many(uint32x4_t *state[], size_t count);
+
+void xoodoo_absorb(duplex_t state, const void *data, size_t length);
+
+void xoodoo_decrypt(duplex_t state, void *data, size_t length);
+
+void xoodoo_encrypt(duplex_t state, void *data, size_t length);
+
+void xoodoo_pad(duplex_t state);
+
+void xoodoo_ratchet(duplex_t state);
+
+void xoodoo_squeeze(duplex_t state, void *data, size_t length);
+
+int xoodoo_open_many(uint32x4_t *state[], uint8_t *const data[],
+  const size_t length[], int result[], size_t count);
+
+void xoodoo_seal_many(uint32x4_t *state[], uint8_t *const data[],
+  const size_t length[], size_t count);
+
+void xoodoo_tree(duplex_t state, const void *data, size_t length);
+
+#endif